@@ -33,6 +33,7 @@
 
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <discordcoreapi/Utilities/RequestCoalescer.hpp>
 
 namespace DiscordCoreAPI {
 
@@ -251,6 +252,7 @@ namespace DiscordCoreAPI {
 		static bool doWeCacheChannels();
 
 	  protected:
+		static RequestCoalescer<Snowflake, ChannelCacheData> fetchCoalescer;
 		static ObjectCache<ChannelCacheData> cache;
 		static DiscordCoreInternal::HttpsClient* httpsClient;
 		static bool doWeCacheChannelsBool;
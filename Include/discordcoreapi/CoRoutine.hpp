@@ -169,6 +169,7 @@ namespace DiscordCoreAPI {
 			if (coroutineHandle) {
 				Milliseconds startTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
 				if (!coroutineHandle.done()) {
+					DiscordCoreInternal::BlockingRegion blockingRegion{};
 					while (!resultBuffer.tryReceive(result)) {
 						Milliseconds now{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
 						uint64_t timeOutNew{ timeOut };
@@ -196,6 +197,7 @@ namespace DiscordCoreAPI {
 			if (coroutineHandle) {
 				Milliseconds startTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
 				if (!coroutineHandle.done()) {
+					DiscordCoreInternal::BlockingRegion blockingRegion{};
 					coroutineHandle.promise().requestStop();
 					while (!resultBuffer.tryReceive(result)) {
 						Milliseconds now{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
@@ -334,6 +336,7 @@ namespace DiscordCoreAPI {
 			if (coroutineHandle) {
 				Milliseconds startTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
 				if (!coroutineHandle.done()) {
+					DiscordCoreInternal::BlockingRegion blockingRegion{};
 					bool result{};
 					while (!resultBuffer.tryReceive(result)) {
 						Milliseconds now{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
@@ -361,6 +364,7 @@ namespace DiscordCoreAPI {
 			if (coroutineHandle) {
 				Milliseconds startTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
 				if (!coroutineHandle.done()) {
+					DiscordCoreInternal::BlockingRegion blockingRegion{};
 					coroutineHandle.promise().requestStop();
 					bool result{};
 					while (!resultBuffer.tryReceive(result)) {
@@ -53,6 +53,7 @@
 #include <discordcoreapi/StickerEntities.hpp>
 #include <discordcoreapi/ThreadEntities.hpp>
 #include <discordcoreapi/UserEntities.hpp>
+#include <discordcoreapi/Utilities/CacheSnapshot.hpp>
 #include <discordcoreapi/Utilities/EventEntities.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
 #include <discordcoreapi/Utilities/TCPConnection.hpp>
@@ -493,6 +493,7 @@ namespace DiscordCoreAPI {
 
 	  protected:
 		static DiscordCoreInternal::HttpsClient* httpsClient;
+		static RequestCoalescer<Snowflake, GuildCacheData> fetchCoalescer;
 		static ObjectCache<GuildCacheData> cache;
 		static DiscordCoreClient* discordCoreClient;
 		static bool doWeCacheGuildsBool;
@@ -35,6 +35,7 @@
 #include <discordcoreapi/JsonSpecializations.hpp>
 #include <discordcoreapi/UserEntities.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <discordcoreapi/Utilities/RequestCoalescer.hpp>
 
 namespace DiscordCoreAPI {
 
@@ -110,6 +111,135 @@ namespace DiscordCoreAPI {
 		Snowflake guildId{};///< The id of the Guild from which you would like to acquire a member.
 	};
 
+	/// @brief A compact alternative to the GuildMember ObjectCache, which keeps each Guild's members in struct-of-arrays form.
+	/// @details Fixed-size fields live in one column per field, role lists are interned per Guild - as most members share a handful of role sets - and nicks
+	/// are packed into a single string arena per Guild. Members are rebuilt into a GuildMemberCacheData on lookup.
+	class DiscordCoreAPI_Dll GuildMemberStore {
+	  public:
+		GuildMemberStore() = default;
+
+		/// @brief Adds or replaces a member.
+		/// @param guildMember The member to be stored.
+		void insert(const GuildMemberCacheData& guildMember);
+
+		/// @brief Adds or replaces a range of members, taking each Guild's lock once per run of members from that Guild.
+		/// @tparam IteratorType The type of the iterators delimiting the range.
+		/// @param first The beginning of the range.
+		/// @param last The end of the range.
+		template<typename IteratorType> inline void insertRange(IteratorType first, IteratorType last) {
+			while (first != last) {
+				Snowflake guildId{ first->guildId };
+				if (guildId == 0) {
+					MessagePrinter::printError<PrintMessageType::General>("GuildMemberStore::insertRange()");
+					for (; first != last && first->guildId == guildId; ++first) {
+					}
+					continue;
+				}
+				GuildColumns& columns{ getColumns(guildId) };
+				std::unique_lock lock{ columns.columnMutex };
+				for (; first != last && first->guildId == guildId; ++first) {
+					try {
+						insertInternal(columns, static_cast<GuildMemberCacheData>(*first));
+					} catch (...) {
+						MessagePrinter::printError<PrintMessageType::General>("GuildMemberStore::insertRange()");
+					}
+				}
+			}
+		}
+
+		/// @brief Rebuilds a stored member.
+		/// @param key The Guild and user ids of the member.
+		/// @param guildMember The member to fill in.
+		/// @return `true` if the member was found, `false` otherwise.
+		bool find(const TwoIdKey& key, GuildMemberCacheData& guildMember);
+
+		/// @brief Check if a member is stored.
+		/// @param key The Guild and user ids of the member.
+		/// @return `true` if the member is stored, `false` otherwise.
+		bool contains(const TwoIdKey& key);
+
+		/// @brief Removes a member.
+		/// @param key The Guild and user ids of the member.
+		void erase(const TwoIdKey& key);
+
+		/// @brief Rebuilds every stored member in turn, one Guild at a time under that Guild's shared lock.
+		/// @tparam FunctionType A callable taking a const reference to a GuildMemberCacheData.
+		/// @param function The function to invoke on each member.
+		template<typename FunctionType> inline void forEach(FunctionType&& function) {
+			std::shared_lock lock{ guildMutex };
+			GuildMemberCacheData guildMember{};
+			for (auto& [key, value]: guilds) {
+				std::shared_lock columnLock{ value->columnMutex };
+				for (uint32_t x = 0; x < value->userIds.size(); ++x) {
+					fillMember(*value, x, key, guildMember);
+					function(static_cast<const GuildMemberCacheData&>(guildMember));
+				}
+			}
+		}
+
+		/// @brief Get the number of members currently stored.
+		/// @return The number of members.
+		uint64_t size();
+
+		/// @brief Get the number of bytes held by the store's columns, arenas and indices.
+		/// @return The number of bytes.
+		uint64_t getMemoryUsage();
+
+	  protected:
+		/// @brief A slice of one of a Guild's arenas.
+		struct ArenaSlice {
+			uint32_t offset{};
+			uint32_t length{};
+		};
+
+		/// @brief The members of a single Guild, one column per field.
+		struct GuildColumns {
+			UnorderedMap<uint64_t, uint32_t> roleSetIndices{};///< Role-list hash to interned role set, probing upwards from the hash on collisions.
+			UnorderedMap<uint64_t, uint32_t> rowIndices{};///< User id to row.
+			Jsonifier::Vector<uint32_t> roleSetRefCounts{};///< The number of rows referencing each interned role set.
+			Jsonifier::Vector<ArenaSlice> roleSets{};///< The interned role sets, as slices of the role arena.
+			Jsonifier::Vector<GuildMemberFlags> flags{};
+			Jsonifier::Vector<uint64_t> permissions{};
+			Jsonifier::Vector<uint32_t> roleSetRows{};
+			Jsonifier::Vector<Snowflake> roleArena{};
+			Jsonifier::Vector<uint64_t> joinedAts{};
+			Jsonifier::Vector<uint64_t> userIds{};
+			Jsonifier::Vector<IconHash> avatars{};
+			Jsonifier::Vector<ArenaSlice> nicks{};
+			std::shared_mutex columnMutex{};
+			uint64_t deadNickBytes{};
+			uint64_t deadRoleSets{};
+			std::string nickArena{};
+		};
+
+		UnorderedMap<uint64_t, UniquePtr<GuildColumns>> guilds{};
+		std::shared_mutex guildMutex{};
+
+		GuildColumns& getColumns(Snowflake guildId);
+
+		GuildColumns* findColumns(Snowflake guildId);
+
+		static void insertInternal(GuildColumns& columns, const GuildMemberCacheData& guildMember);
+
+		static void fillMember(const GuildColumns& columns, uint32_t row, Snowflake guildId, GuildMemberCacheData& guildMember);
+
+		static uint32_t internRoleSet(GuildColumns& columns, const Jsonifier::Vector<Snowflake>& roles);
+
+		static void releaseRoleSet(GuildColumns& columns, uint32_t roleSet);
+
+		static void indexRoleSet(GuildColumns& columns, uint32_t roleSet);
+
+		static uint64_t getRoleSetHash(const Snowflake* roles, uint64_t length);
+
+		static void compactRoleSets(GuildColumns& columns);
+
+		static void reclaimArenas(GuildColumns& columns);
+
+		static ArenaSlice appendNick(GuildColumns& columns, std::string_view nick);
+
+		static void compactNicks(GuildColumns& columns);
+	};
+
 	/**@}*/
 
 
@@ -187,13 +317,22 @@ namespace DiscordCoreAPI {
 
 		static void removeVoiceState(const TwoIdKey& voiceState);
 
+		inline static GuildMemberStore& getMemberStore() {
+			return memberStore;
+		}
+
 		static bool doWeCacheGuildMembers();
 
+		static bool doWeCompactGuildMembers();
+
 	  protected:
 		static DiscordCoreInternal::HttpsClient* httpsClient;
 		static ObjectCache<VoiceStateDataLight> vsCache;
+		static RequestCoalescer<TwoIdKey, GuildMemberCacheData> fetchCoalescer;
 		static ObjectCache<GuildMemberCacheData> cache;
+		static bool doWeCompactGuildMembersBool;
 		static bool doWeCacheGuildMembersBool;
+		static GuildMemberStore memberStore;
 	};
 	/**@}*/
 };// namespace DiscordCoreAPI
@@ -34,6 +34,7 @@
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/GuildMemberEntities.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <discordcoreapi/Utilities/RequestCoalescer.hpp>
 
 namespace DiscordCoreAPI {
 
@@ -209,6 +210,7 @@ namespace DiscordCoreAPI {
 
 	  protected:
 		static DiscordCoreInternal::HttpsClient* httpsClient;
+		static RequestCoalescer<Snowflake, RoleCacheData> fetchCoalescer;
 		static ObjectCache<RoleCacheData> cache;
 		static bool doWeCacheRolesBool;
 	};
@@ -52,6 +52,8 @@ namespace DiscordCoreAPI {
 		friend class GuildCacheData;
 		friend class GuildData;
 
+		static constexpr uint64_t framesPerSecond{ 50 };///< The number of 20 ms frames in a second of audio.
+
 		DiscordCoreInternal::Event<CoRoutine<void, false>, SongCompletionEventData> onSongCompletionEvent{};
 		UnboundedMessageBlock<AudioFrameData> audioDataBuffer{};
 		DiscordCoreInternal::EventDelegateToken eventToken{};
@@ -98,10 +100,21 @@ namespace DiscordCoreAPI {
 		~SongAPI();
 
 	  protected:
+		std::atomic_uint64_t queuedFramesWanted{};
+		std::condition_variable queueSpaceCondition{};
 		CoRoutine<void, false> taskThread{};
 		std::recursive_mutex accessMutex{};
+		std::mutex queueSpaceMutex{};
 		Snowflake guildId{};
 
+		/// @brief Blocks a downloader until audioDataBuffer holds fewer than maxQueuedFrames frames, or it is told to stop.
+		/// @param maxQueuedFrames The number of queued frames to wait to fall below.
+		/// @param areWeStopped Checked on each wake-up, and every 20 ms, since cancelling the downloader does not signal this wait.
+		void waitForQueueSpace(uint64_t maxQueuedFrames, const std::function<bool()>& areWeStopped);
+
+		/// @brief Wakes a downloader waiting in waitForQueueSpace(), if the queue has drained below what it is waiting for.
+		void notifyQueueSpace();
+
 		void disconnect();
 	};
 	/**@}*/
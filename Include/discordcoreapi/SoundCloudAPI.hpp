@@ -75,6 +75,7 @@ namespace DiscordCoreAPI {
 
 		  protected:
 			std::atomic_bool areWeWorkingBool{ false };
+			StreamingOptions streamingOptions{};
 			Snowflake guildId{};
 		};
 
@@ -33,6 +33,7 @@
 
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <discordcoreapi/Utilities/RequestCoalescer.hpp>
 #include <discordcoreapi/Utilities/WebSocketClient.hpp>
 
 namespace DiscordCoreAPI {
@@ -161,6 +162,7 @@ namespace DiscordCoreAPI {
 
 	  protected:
 		static DiscordCoreInternal::HttpsClient* httpsClient;
+		static RequestCoalescer<Snowflake, UserCacheData> fetchCoalescer;
 		static ObjectCache<UserCacheData> cache;
 		static bool doWeCacheUsersBool;
 	};
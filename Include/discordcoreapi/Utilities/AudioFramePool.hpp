@@ -0,0 +1,156 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// AudioFramePool.hpp - Header file for the AudioFramePool class.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file AudioFramePool.hpp
+
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+
+namespace DiscordCoreAPI {
+
+	namespace DiscordCoreInternal {
+
+		/**
+		 * \addtogroup discord_core_internal
+		 * @{
+		 */
+
+		/// @brief A slot of an AudioFramePoolQueue - its sequence is kept relative to its index, so that the zero-initialized slots start out empty.
+		struct AudioFramePoolCell {
+			std::atomic_uint64_t sequence{};
+			Jsonifier::Vector<uint8_t> buffer{};
+		};
+
+		/// @brief A bounded multi-producer, multi-consumer queue of idle buffers of a single size class.
+		class AudioFramePoolQueue {
+		  public:
+			static constexpr uint64_t queueSize{ 256 };///< The number of idle buffers that are kept.
+
+			/// @brief Hands a buffer to the queue.
+			/// @param buffer The buffer.
+			/// @return `false` if the queue was full.
+			inline bool tryPush(Jsonifier::Vector<uint8_t>&& buffer) {
+				uint64_t position{ pushPosition.load(std::memory_order_relaxed) };
+				while (true) {
+					AudioFramePoolCell& cell{ cells[position % queueSize] };
+					int64_t difference{ static_cast<int64_t>(cell.sequence.load(std::memory_order_acquire) + position % queueSize - position) };
+					if (difference == 0) {
+						if (pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+							cell.buffer = std::move(buffer);
+							cell.sequence.store(position + 1 - position % queueSize, std::memory_order_release);
+							return true;
+						}
+					} else if (difference < 0) {
+						return false;
+					} else {
+						position = pushPosition.load(std::memory_order_relaxed);
+					}
+				}
+			}
+
+			/// @brief Takes a buffer from the queue.
+			/// @param buffer Set to the buffer.
+			/// @return `false` if the queue was empty.
+			inline bool tryPop(Jsonifier::Vector<uint8_t>& buffer) {
+				uint64_t position{ popPosition.load(std::memory_order_relaxed) };
+				while (true) {
+					AudioFramePoolCell& cell{ cells[position % queueSize] };
+					int64_t difference{ static_cast<int64_t>(cell.sequence.load(std::memory_order_acquire) + position % queueSize - (position + 1)) };
+					if (difference == 0) {
+						if (popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+							buffer = std::move(cell.buffer);
+							cell.sequence.store(position + queueSize - position % queueSize, std::memory_order_release);
+							return true;
+						}
+					} else if (difference < 0) {
+						return false;
+					} else {
+						position = popPosition.load(std::memory_order_relaxed);
+					}
+				}
+			}
+
+		  protected:
+			std::array<AudioFramePoolCell, queueSize> cells{};
+			alignas(64) std::atomic_uint64_t pushPosition{};
+			alignas(64) std::atomic_uint64_t popPosition{};
+		};
+
+		/// @brief A lock-free pool of the buffers that hold audio frames, so that streaming a Song reuses the same memory rather than allocating a buffer for
+		/// every 20 ms frame.
+		/// @details Buffers are pooled in power-of-two size classes, from 256 bytes - enough for a typical Opus frame - up to 4 KiB - enough for 20 ms of 48 kHz
+		/// stereo 16-bit PCM - so that a frame never holds more than twice the memory it needs. Larger buffers are allocated to size and never pooled, and
+		/// buffers released into a full size class are freed.
+		class AudioFramePool {
+		  public:
+			static constexpr uint64_t minimumClassSize{ 256 };///< The size of the smallest size class.
+			static constexpr uint64_t sizeClassCount{ 5 };///< The number of size classes.
+			static constexpr uint64_t maximumClassSize{ minimumClassSize << (sizeClassCount - 1) };///< The size of the largest size class.
+
+			/// @brief Takes an idle buffer from the pool, or allocates one if there are none.
+			/// @param size The number of bytes the buffer has to hold.
+			/// @return The buffer, whose size is at least the requested one.
+			inline static Jsonifier::Vector<uint8_t> acquire(uint64_t size) {
+				Jsonifier::Vector<uint8_t> buffer{};
+				if (size > maximumClassSize) {
+					buffer.resize(size);
+					return buffer;
+				}
+				uint64_t sizeClass{ getSizeClass(size) };
+				if (!queues[sizeClass].tryPop(buffer)) {
+					buffer.resize(minimumClassSize << sizeClass);
+				}
+				return buffer;
+			}
+
+			/// @brief Returns a buffer to the pool.
+			/// @param buffer The buffer - ones that aren't the size of a size class are freed.
+			inline static void release(Jsonifier::Vector<uint8_t>&& buffer) {
+				uint64_t size{ buffer.size() };
+				if (size < minimumClassSize || size > maximumClassSize || (size & (size - 1)) != 0) {
+					return;
+				}
+				queues[getSizeClass(size)].tryPush(std::move(buffer));
+			}
+
+		  protected:
+			inline static std::array<AudioFramePoolQueue, sizeClassCount> queues{};
+
+			inline static uint64_t getSizeClass(uint64_t size) {
+				uint64_t sizeClass{};
+				while ((minimumClassSize << sizeClass) < size) {
+					++sizeClass;
+				}
+				return sizeClass;
+			}
+		};
+
+		/**@}*/
+	}
+}
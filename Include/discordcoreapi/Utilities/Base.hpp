@@ -81,6 +81,8 @@ inline std::tm getCurrentTimeVal(time_t& result) {
 
 #include <jsonifier/Index.hpp>
 
+#include <charconv>
+#include <condition_variable>
 #include <source_location>
 #include <shared_mutex>
 #include <immintrin.h>
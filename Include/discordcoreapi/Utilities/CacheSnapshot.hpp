@@ -0,0 +1,111 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// CacheSnapshot.hpp - Header file for the CacheSnapshot class.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file CacheSnapshot.hpp
+
+#pragma once
+
+#include <discordcoreapi/Utilities/Utilities.hpp>
+
+namespace DiscordCoreAPI {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief A shard's gateway session, as needed to resume it.
+	struct SnapshotSession {
+		std::string resumeUrl{};///< The url to resume the session at.
+		std::string sessionId{};///< The id of the session.
+		uint32_t lastNumberReceived{};///< The sequence number of the last dispatch reflected in the caches.
+	};
+
+	/// @brief Saves the Guild, Channel, Role, GuildMember and User caches to a binary file, and maps it back in on start-up.
+	/// @details The snapshot also carries each shard's session, so a restarted shard resumes - and is replayed whatever it missed - rather than re-identifying
+	/// and waiting on a GUILD_CREATE for every Guild. A snapshot from a different format, build layout, bot token or shard count is ignored.
+	class DiscordCoreAPI_Dll CacheSnapshot {
+	  public:
+		static constexpr uint32_t formatVersion{ 1 };///< Bumped whenever the on-disk layout changes.
+
+		/// @brief Reads the snapshot options and sizes the per-shard session table.
+		/// @param configManagerNew The library's ConfigManager.
+		static void initialize(ConfigManager* configManagerNew);
+
+		/// @brief Writes the caches and sessions to the snapshot file, through a temporary file that then replaces it.
+		/// @return `true` if the snapshot was written, `false` if snapshotting is disabled or the write failed.
+		static bool save();
+
+		/// @brief Maps the snapshot file in and loads its contents into the caches and the session table.
+		/// @return `true` if a snapshot was loaded, `false` if there was none or it was unusable.
+		static bool load();
+
+		/// @brief Records a shard's session, once it has been READY'd.
+		/// @param shard The index of the shard.
+		/// @param sessionId The id of the session.
+		/// @param resumeUrl The url to resume the session at.
+		static void recordSession(uint32_t shard, std::string_view sessionId, std::string_view resumeUrl);
+
+		/// @brief Records the sequence number of the last dispatch a shard has finished applying to the caches.
+		/// @param shard The index of the shard.
+		/// @param sequence The sequence number.
+		static void recordSequence(uint32_t shard, uint32_t sequence);
+
+		/// @brief Forgets a shard's session, once it can no longer be resumed.
+		/// @details Whatever the snapshot loaded for the shard's Guilds is then of unknown age, and nothing that the shard will be sent could correct all of
+		/// it, so those Guilds are evicted along with their Channels, Roles and GuildMembers - to be filled back in by the GUILD_CREATEs that follow.
+		/// @param shard The index of the shard.
+		static void dropSession(uint32_t shard);
+
+		/// @brief Marks the Guilds that the snapshot loaded for a shard as current, once the shard has resumed its session.
+		/// @param shard The index of the shard.
+		static void confirmSession(uint32_t shard);
+
+		/// @brief Collects a shard's session, if one is known.
+		/// @param shard The index of the shard.
+		/// @param session The session to fill in.
+		/// @return `true` if a resumable session was found, `false` otherwise.
+		static bool getSession(uint32_t shard, SnapshotSession& session);
+
+		/// @brief Whether snapshotting is enabled.
+		/// @return `true` if a snapshot path was configured.
+		static bool doWeSnapshot();
+
+	  protected:
+		static UnorderedMap<uint64_t, Jsonifier::Vector<Snowflake>> loadedGuilds;
+		static UniquePtr<std::atomic_uint32_t[]> sequences;
+		static UnorderedMap<uint64_t, SnapshotSession> sessions;
+		static std::mutex sessionMutex;
+		static std::mutex saveMutex;
+		static uint32_t totalShardCount;
+		static uint64_t botTokenHash;
+		static std::string path;
+	};
+
+	/**@}*/
+}
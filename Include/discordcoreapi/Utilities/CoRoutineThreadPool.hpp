@@ -32,8 +32,10 @@
 
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
+#include <condition_variable>
 #include <coroutine>
 #include <thread>
+#include <deque>
 
 namespace DiscordCoreAPI {
 
@@ -44,113 +46,378 @@ namespace DiscordCoreAPI {
 		* @{
 		*/
 
+		/// @brief A fixed-capacity, lock-free Chase-Lev deque of coroutine handles.
+		/// @details The owning worker pushes and pops at the bottom, while any other thread may steal from the top.
+		class WorkStealingDeque {
+		  public:
+			static constexpr int64_t capacity{ 1024 };///< Maximum number of queued handles.
+
+			inline WorkStealingDeque() = default;
+
+			/// @brief Push a coroutine onto the bottom of the deque - owner only.
+			/// @param coro The coroutine handle to push.
+			/// @return True if the handle was queued, false if the deque is full.
+			inline bool push(std::coroutine_handle<> coro) {
+				int64_t bottomNew = bottom.load(std::memory_order_relaxed);
+				int64_t topNew	  = top.load(std::memory_order_acquire);
+				if (bottomNew - topNew >= capacity) {
+					return false;
+				}
+				buffer[static_cast<uint64_t>(bottomNew) & mask].store(coro.address(), std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_release);
+				bottom.store(bottomNew + 1, std::memory_order_relaxed);
+				return true;
+			}
+
+			/// @brief Pop the most recently pushed coroutine - owner only.
+			/// @param coro The coroutine handle to populate.
+			/// @return True if a handle was collected.
+			inline bool pop(std::coroutine_handle<>& coro) {
+				int64_t bottomNew = bottom.load(std::memory_order_relaxed) - 1;
+				bottom.store(bottomNew, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				int64_t topNew = top.load(std::memory_order_relaxed);
+				if (topNew > bottomNew) {
+					bottom.store(bottomNew + 1, std::memory_order_relaxed);
+					return false;
+				}
+				void* address = buffer[static_cast<uint64_t>(bottomNew) & mask].load(std::memory_order_relaxed);
+				if (topNew == bottomNew) {
+					bool didWeWin = top.compare_exchange_strong(topNew, topNew + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+					bottom.store(bottomNew + 1, std::memory_order_relaxed);
+					if (!didWeWin) {
+						return false;
+					}
+				}
+				coro = std::coroutine_handle<>::from_address(address);
+				return true;
+			}
+
+			/// @brief Steal the oldest coroutine - callable from any thread.
+			/// @param coro The coroutine handle to populate.
+			/// @return True if a handle was collected.
+			inline bool steal(std::coroutine_handle<>& coro) {
+				int64_t topNew = top.load(std::memory_order_acquire);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				int64_t bottomNew = bottom.load(std::memory_order_acquire);
+				if (topNew >= bottomNew) {
+					return false;
+				}
+				void* address = buffer[static_cast<uint64_t>(topNew) & mask].load(std::memory_order_relaxed);
+				if (!top.compare_exchange_strong(topNew, topNew + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+					return false;
+				}
+				coro = std::coroutine_handle<>::from_address(address);
+				return true;
+			}
+
+			/// @brief Check whether the deque looks empty - callable from any thread, though the answer may be stale by the time it is used.
+			/// @return True if no handles were queued when checked.
+			inline bool empty() const {
+				return top.load(std::memory_order_acquire) >= bottom.load(std::memory_order_acquire);
+			}
+
+		  protected:
+			static constexpr uint64_t mask{ static_cast<uint64_t>(capacity) - 1 };
+			static_assert((capacity & (capacity - 1)) == 0, "WorkStealingDeque's capacity must be a power of two.");
+
+			std::array<std::atomic<void*>, capacity> buffer{};///< Ring of queued coroutine addresses.
+			alignas(64) std::atomic_int64_t top{};///< Index stolen from.
+			alignas(64) std::atomic_int64_t bottom{};///< Index pushed to and popped from by the owner.
+		};
+
 		/// @brief A struct representing a worker thread for coroutine-based tasks.
 		struct WorkerThread {
 			inline WorkerThread() = default;
 
 			inline ~WorkerThread() = default;
 
-			UnboundedMessageBlock<std::coroutine_handle<>> tasks{};///< Queue of coroutine tasks.
-			std::atomic_bool areWeCurrentlyWorking{};///< Atomic flag indicating if the thread is working.
+			WorkStealingDeque tasks{};///< Queue of coroutine tasks owned by this worker.
 			ThreadWrapper thread{};///< Joinable thread.
 		};
 
-		/// @brief A class representing a coroutine-based thread pool.
-		class CoRoutineThreadPool {
+		/// @brief A class representing a work-stealing, coroutine-based thread pool.
+		/// @details Each core worker owns a lock-free deque, steals from random victims when it runs dry, and parks on a condition variable when there is
+		/// nothing left to do. If every thread is busy when a task arrives, a bounded number of overflow workers is spawned - these retire again after idling.
+		/// Workers that block inside a BlockingRegion - such as CoRoutine::get() - don't count against that bound, so a replacement is spawned for each one
+		/// while there is queued work, and the tasks they wait on still get to run.
+		class CoRoutineThreadPool final : public BlockingHandler {
 		  public:
 			friend class DiscordCoreAPI::DiscordCoreClient;///< Friend class declaration.
 
 			/// @brief Constructor to create a coroutine thread pool. Initializes the worker threads.
-			inline CoRoutineThreadPool() : threadCount(ThreadWrapper::hardware_concurrency()) {
-				for (uint32_t x = 0; x < threadCount; ++x) {
-					UniquePtr<WorkerThread> workerThread{ makeUnique<WorkerThread>() };
-					currentIndex.store(currentIndex.load(std::memory_order_acquire) + 1, std::memory_order_release);
-					currentCount.store(currentCount.load(std::memory_order_acquire) + 1, std::memory_order_release);
-					uint64_t indexNew	 = currentIndex.load(std::memory_order_acquire);
-					workerThread->thread = ThreadWrapper([=, this](StopToken stopToken) {
-						threadFunction(stopToken, indexNew);
+			inline CoRoutineThreadPool()
+				: threadCount(std::max<uint64_t>(ThreadWrapper::hardware_concurrency(), 1)), maxThreadCount(threadCount * overflowFactor) {
+				for (uint64_t x = 0; x < threadCount; ++x) {
+					workerThreads.emplace_back(makeUnique<WorkerThread>());
+				}
+				totalThreadCount.store(threadCount, std::memory_order_release);
+				for (uint64_t x = 0; x < threadCount; ++x) {
+					workerThreads[x]->thread = ThreadWrapper([=, this](StopToken stopToken) {
+						threadFunction(stopToken, x);
 					});
-					workerThreads.emplace(currentIndex.load(std::memory_order_acquire), std::move(workerThread));
 				}
 			}
 
 			/// @brief Submit a coroutine task to the thread pool.
 			/// @param coro The coroutine handle to submit.
 			inline void submitTask(std::coroutine_handle<> coro) {
-				bool areWeAllBusy{ true };
-				uint64_t currentLowestValue{ std::numeric_limits<uint64_t>::max() };
-				uint64_t currentLowestIndex{ std::numeric_limits<uint64_t>::max() };
-				std::shared_lock lock01{ workerAccessMutex };
-				for (auto& [key, value]: workerThreads) {
-					if (!value->areWeCurrentlyWorking.load(std::memory_order_acquire)) {
-						areWeAllBusy = false;
-						if (value->tasks.size() < currentLowestValue) {
-							currentLowestValue = value->tasks.size();
-							currentLowestIndex = key;
-						}
-						break;
+				if (currentWorkerIndex >= workerThreads.size() || !workerThreads[currentWorkerIndex]->tasks.push(coro)) {
+					std::unique_lock lock{ injectionMutex };
+					injectionQueue.emplace_back(coro);
+					injectionCount.fetch_add(1, std::memory_order_release);
+				}
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (sleepingCount.load(std::memory_order_relaxed) > 0) {
+					std::unique_lock lock{ sleepMutex };
+					if (wakeTokens < sleepingCount.load(std::memory_order_relaxed)) {
+						++wakeTokens;
+						lock.unlock();
+						sleepCondition.notify_one();
 					}
+				} else if (busyCount.load(std::memory_order_acquire) + blockedCount.load(std::memory_order_acquire) >= totalThreadCount.load(std::memory_order_acquire)) {
+					spawnOverflowWorker();
 				}
-				if (areWeAllBusy) {
-					UniquePtr<WorkerThread> workerThread{ makeUnique<WorkerThread>() };
-					currentIndex.store(currentIndex.load(std::memory_order_acquire) + 1, std::memory_order_release);
-					currentCount.store(currentCount.load(std::memory_order_acquire) + 1, std::memory_order_release);
-					uint64_t indexNew	 = currentIndex.load(std::memory_order_acquire);
-					workerThread->thread = ThreadWrapper([=, this](StopToken stopToken) {
-						threadFunction(stopToken, indexNew);
-					});
-					lock01.unlock();
-					std::unique_lock lock02{ workerAccessMutex };
-					workerThreads.emplace(currentIndex.load(std::memory_order_acquire), std::move(workerThread));
-					lock02.unlock();
-				} else {
-					workerThreads[currentLowestIndex]->tasks.send(std::move(coro));
+			}
+
+			/// @brief Takes a worker that is about to block out of the running count, and stands in a replacement if there is queued work and no idle worker.
+			inline void beginBlocking() override {
+				busyCount.fetch_sub(1, std::memory_order_acq_rel);
+				blockedCount.fetch_add(1, std::memory_order_acq_rel);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (sleepingCount.load(std::memory_order_relaxed) == 0 && areThereQueuedTasks()) {
+					spawnOverflowWorker();
+				}
+			}
+
+			/// @brief Returns a worker that has stopped blocking to the running count.
+			inline void endBlocking() override {
+				blockedCount.fetch_sub(1, std::memory_order_acq_rel);
+				busyCount.fetch_add(1, std::memory_order_acq_rel);
+			}
+
+			/// @brief Stops and detaches every worker, waking any that are parked.
+			inline void requestStop() {
+				for (auto& value: workerThreads) {
+					if (value->thread.joinable()) {
+						value->thread.requestStop();
+						value->thread.detach();
+					}
+				}
+				std::unique_lock lock{ overflowMutex };
+				for (auto& [key, value]: overflowThreads) {
+					if (value->joinable()) {
+						value->requestStop();
+						value->detach();
+					}
+				}
+				lock.unlock();
+				wakeAll();
+			}
+
+			inline ~CoRoutineThreadPool() {
+				for (auto& value: workerThreads) {
+					value->thread.requestStop();
+				}
+				std::unique_lock lock{ overflowMutex };
+				UnorderedMap<uint64_t, UniquePtr<ThreadWrapper>> overflowThreadsNew{ std::move(overflowThreads) };
+				for (auto& [key, value]: overflowThreadsNew) {
+					value->requestStop();
+				}
+				lock.unlock();
+				wakeAll();
+				for (auto& value: workerThreads) {
+					if (value->thread.joinable()) {
+						value->thread.join();
+					}
+				}
+				for (auto& [key, value]: overflowThreadsNew) {
+					if (value->joinable()) {
+						value->join();
+					}
 				}
 			}
 
 		  protected:
-			UnorderedMap<uint64_t, UniquePtr<WorkerThread>> workerThreads{};///< Map of worker threads.
-			std::shared_mutex workerAccessMutex{};///< Shared mutex for worker thread access.
-			std::atomic_uint64_t currentCount{};///< Current count of worker threads.
-			std::atomic_uint64_t currentIndex{};///< Current index of worker threads.
-			const uint64_t threadCount{};///< Total thread count.
+			static constexpr Milliseconds overflowIdleTime{ 5000 };///< How long an overflow worker idles before retiring.
+			static constexpr uint64_t overflowFactor{ 4 };///< Overflow workers may take the unblocked thread count up to this multiple of the core count.
+			inline static thread_local uint64_t currentWorkerIndex{ std::numeric_limits<uint64_t>::max() };///< Index of the core worker running on this thread.
+			inline static thread_local uint64_t randomState{};///< Per-thread state for picking steal victims.
+
+			UnorderedMap<uint64_t, UniquePtr<ThreadWrapper>> overflowThreads{};///< Map of overflow worker threads.
+			Jsonifier::Vector<UniquePtr<WorkerThread>> workerThreads{};///< Core worker threads - fixed after construction.
+			std::deque<std::coroutine_handle<>> injectionQueue{};///< Tasks submitted from outside of the core workers.
+			std::condition_variable sleepCondition{};///< Condition variable that idle workers park on.
+			std::atomic_uint64_t totalThreadCount{};///< Current count of core and overflow worker threads.
+			std::atomic_uint64_t sleepingCount{};///< Number of currently parked workers.
+			std::atomic_uint64_t injectionCount{};///< Number of tasks in the injection queue.
+			std::atomic_uint64_t overflowIndex{};///< Key of the most recently spawned overflow worker.
+			std::atomic_uint64_t blockedCount{};///< Number of workers currently blocked inside a BlockingRegion.
+			std::atomic_uint64_t busyCount{};///< Number of workers currently running a task.
+			const uint64_t threadCount{};///< Core thread count.
+			const uint64_t maxThreadCount{};///< Upper bound on the total thread count, not counting blocked workers.
+			std::mutex injectionMutex{};///< Mutex for the injection queue.
+			std::mutex overflowMutex{};///< Mutex for the overflow worker map.
+			std::mutex sleepMutex{};///< Mutex guarding parking and wake tokens.
+			uint64_t wakeTokens{};///< Pending wake-ups for parked workers.
+
+			/// @brief Wakes every parked worker, so that they may observe a stop request.
+			inline void wakeAll() {
+				std::unique_lock lock{ sleepMutex };
+				lock.unlock();
+				sleepCondition.notify_all();
+			}
+
+			/// @brief Returns a cheap pseudo-random number for victim selection.
+			/// @return The next value of this thread's xorshift sequence.
+			inline static uint64_t nextRandom() {
+				if (randomState == 0) {
+					randomState = std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+				}
+				randomState ^= randomState << 13;
+				randomState ^= randomState >> 7;
+				randomState ^= randomState << 17;
+				return randomState;
+			}
+
+			/// @brief Collects the next task, from the local deque, the injection queue, or a random victim.
+			/// @param index The index of the calling core worker, or an out-of-range value for overflow workers.
+			/// @param coro The coroutine handle to populate.
+			/// @return True if a task was collected.
+			inline bool findTask(uint64_t index, std::coroutine_handle<>& coro) {
+				if (index < workerThreads.size() && workerThreads[index]->tasks.pop(coro)) {
+					return true;
+				}
+				if (injectionCount.load(std::memory_order_acquire) > 0) {
+					std::unique_lock lock{ injectionMutex };
+					if (!injectionQueue.empty()) {
+						coro = injectionQueue.front();
+						injectionQueue.pop_front();
+						injectionCount.fetch_sub(1, std::memory_order_release);
+						return true;
+					}
+				}
+				uint64_t victimCount{ workerThreads.size() };
+				uint64_t startIndex{ nextRandom() % victimCount };
+				for (uint64_t x = 0; x < victimCount; ++x) {
+					uint64_t victim{ (startIndex + x) % victimCount };
+					if (victim != index && workerThreads[victim]->tasks.steal(coro)) {
+						return true;
+					}
+				}
+				return false;
+			}
+
+			/// @brief Check whether any task is waiting to be collected.
+			/// @return True if the injection queue or any worker's deque held a task when checked.
+			inline bool areThereQueuedTasks() {
+				if (injectionCount.load(std::memory_order_acquire) > 0) {
+					return true;
+				}
+				for (auto& value: workerThreads) {
+					if (!value->tasks.empty()) {
+						return true;
+					}
+				}
+				return false;
+			}
+
+			/// @brief Resumes a collected task.
+			/// @param coro The coroutine handle to resume.
+			inline void runTask(std::coroutine_handle<> coro) {
+				busyCount.fetch_add(1, std::memory_order_acq_rel);
+				try {
+					coro();
+				} catch (const DCAException& error) {
+					MessagePrinter::printError<PrintMessageType::General>(error.what());
+				}
+				busyCount.fetch_sub(1, std::memory_order_acq_rel);
+			}
 
-			/// @brief Thread function for each worker thread.
+			/// @brief Parks the calling worker until a task arrives, a stop is requested, or the timeout elapses.
+			/// @param index The index of the calling worker.
+			/// @param coro The coroutine handle to populate, if a task is found before parking.
+			/// @param stopToken The stop token for the thread.
+			/// @param timeOut Whether to give up after overflowIdleTime.
+			/// @return False only if the wait timed out.
+			inline bool park(uint64_t index, std::coroutine_handle<>& coro, StopToken& stopToken, bool timeOut) {
+				std::unique_lock lock{ sleepMutex };
+				sleepingCount.fetch_add(1, std::memory_order_seq_cst);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (findTask(index, coro)) {
+					sleepingCount.fetch_sub(1, std::memory_order_release);
+					return true;
+				}
+				auto predicate = [&] {
+					return wakeTokens > 0 || stopToken.stopRequested();
+				};
+				bool wasWoken{ true };
+				if (timeOut) {
+					wasWoken = sleepCondition.wait_for(lock, overflowIdleTime, predicate);
+				} else {
+					sleepCondition.wait(lock, predicate);
+				}
+				if (wakeTokens > 0) {
+					--wakeTokens;
+				}
+				sleepingCount.fetch_sub(1, std::memory_order_release);
+				return wasWoken;
+			}
+
+			/// @brief Spawns an overflow worker, if the thread count has not reached its bound - which blocked workers are added on top of.
+			inline void spawnOverflowWorker() {
+				std::unique_lock lock{ overflowMutex };
+				if (totalThreadCount.load(std::memory_order_acquire) >= maxThreadCount + blockedCount.load(std::memory_order_acquire)) {
+					return;
+				}
+				totalThreadCount.fetch_add(1, std::memory_order_acq_rel);
+				uint64_t indexNew{ overflowIndex.fetch_add(1, std::memory_order_acq_rel) + 1 };
+				overflowThreads.emplace(indexNew, makeUnique<ThreadWrapper>([=, this](StopToken stopToken) {
+					overflowThreadFunction(stopToken, indexNew);
+				}));
+			}
+
+			/// @brief Thread function for each core worker thread.
 			/// @param stopToken The stop token for the thread.
 			/// @param index The index of the worker thread.
 			inline void threadFunction(StopToken stopToken, uint64_t index) {
+				BlockingRegion::handler = this;
+				currentWorkerIndex		= index;
 				while (!stopToken.stopRequested()) {
-					if (!workerThreads.contains(index)) {
-						return;
+					std::coroutine_handle<> coroHandle{};
+					if (findTask(index, coroHandle) || (park(index, coroHandle, stopToken, false) && coroHandle)) {
+						runTask(coroHandle);
 					}
+				}
+			}
+
+			/// @brief Thread function for each overflow worker thread, which retires after idling.
+			/// @param stopToken The stop token for the thread.
+			/// @param index The key of the worker thread.
+			inline void overflowThreadFunction(StopToken stopToken, uint64_t index) {
+				BlockingRegion::handler = this;
+				while (!stopToken.stopRequested()) {
 					std::coroutine_handle<> coroHandle{};
-					if (workerThreads[index]->tasks.tryReceive(coroHandle)) {
-						workerThreads[index]->areWeCurrentlyWorking.store(true, std::memory_order_release);
-						try {
-							coroHandle();
-						} catch (const DCAException& error) {
-							MessagePrinter::printError<PrintMessageType::General>(error.what());
+					if (findTask(std::numeric_limits<uint64_t>::max(), coroHandle)) {
+						runTask(coroHandle);
+					} else if (park(std::numeric_limits<uint64_t>::max(), coroHandle, stopToken, true)) {
+						if (coroHandle) {
+							runTask(coroHandle);
 						}
-						if (!workerThreads.contains(index)) {
-							return;
+					} else {
+						std::unique_lock lock{ overflowMutex };
+						if (findTask(std::numeric_limits<uint64_t>::max(), coroHandle)) {
+							lock.unlock();
+							runTask(coroHandle);
+							continue;
 						}
-						workerThreads[index]->areWeCurrentlyWorking.store(false, std::memory_order_release);
-					}
-					if (currentCount.load(std::memory_order_acquire) > threadCount) {
-						uint64_t extraWorkers{ currentCount.load(std::memory_order_acquire) - threadCount };
-						while (extraWorkers > 0) {
-							--extraWorkers;
-							std::unique_lock lock{ workerAccessMutex };
-							auto oldThread = workerThreads.begin();
-							if (oldThread.operator*().second->thread.joinable()) {
-								oldThread.operator*().second->thread.requestStop();
-								oldThread.operator*().second->thread.detach();
-								currentCount.store(currentCount.load(std::memory_order_acquire) - 1, std::memory_order_release);
-								workerThreads.erase(oldThread.operator*().first);
-							}
+						totalThreadCount.fetch_sub(1, std::memory_order_acq_rel);
+						if (overflowThreads.contains(index)) {
+							overflowThreads[index]->detach();
+							overflowThreads.erase(index);
 						}
+						return;
 					}
-					std::this_thread::sleep_for(100000ns);
 				}
 			}
 		};
@@ -54,15 +54,22 @@ namespace DiscordCoreAPI {
 			7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 };
 
 		/// @brief A class for demuxing Matroska-contained audio data.
+		/// @details Data is pushed in as it arrives - only the bytes of a not-yet-complete element are kept between writes, so the memory held stays bounded
+		/// however long the track is.
 		class MatroskaDemuxer {
 		  public:
 			/// @brief Constructor for MatroskaDemuxer.
 			inline MatroskaDemuxer() = default;
 
 			/// @brief Writes data to the Matroska demuxer.
-			/// @param dataNew The data to be written.
+			/// @param dataNew The data to be written, which continues on from the previously written data.
 			inline void writeData(std::basic_string_view<uint8_t> dataNew) {
-				data = dataNew;
+				data.append(dataNew);
+			}
+
+			/// @brief Marks the end of the input, after which whatever can't be parsed out of the remaining data is dropped.
+			inline void endOfStream() {
+				areWeAtEndOfStream = true;
 			}
 
 			/// @brief Collects the next frame from the demuxer.
@@ -70,8 +77,8 @@ namespace DiscordCoreAPI {
 			/// @return True if a frame was collected, false otherwise.
 			inline bool collectFrame(AudioFrameData& frameNew) {
 				if (frames.size() > 0) {
-					frameNew = std::move(frames.at(0));
-					frames.erase(frames.begin());
+					frameNew = std::move(frames.front());
+					frames.pop_front();
 					return true;
 				} else {
 					return false;
@@ -81,56 +88,50 @@ namespace DiscordCoreAPI {
 			/// @brief Proceed with the demuxing process.
 			inline void proceedDemuxing() {
 				if (!doWeHaveTotalSize) {
+					if (currentPosition + sizeof(uint32_t) > data.size()) {
+						finishDemuxing();
+						return;
+					}
 					if (reverseBytes<uint32_t>() != SEGMENT_ID) {
-						MessagePrinter::printError<PrintMessageType::General>(
-							"Missing a Segment, which was expected at index: " + std::to_string(currentPosition) + std::string{ "..." });
+						if (!areWeSearchingForSegment) {
+							MessagePrinter::printError<PrintMessageType::General>(
+								"Missing a Segment, which was expected at index: " + std::to_string(consumedSize + currentPosition) + std::string{ "..." });
+							areWeSearchingForSegment = true;
+						}
 						if (!findNextId(SEGMENT_ID)) {
-							if ((totalSize > 0 && currentPosition >= totalSize)) {
-								areWeDoneVal = true;
-							}
+							finishDemuxing();
 							return;
 						}
-						MessagePrinter::printSuccess<PrintMessageType::General>("Missing Segment, found at index: " + std::to_string(currentPosition) + ".");
-					} else {
-						currentPosition += sizeof(uint32_t);
+						MessagePrinter::printSuccess<PrintMessageType::General>("Missing Segment, found at index: " + std::to_string(consumedSize + currentPosition) + ".");
+					}
+					if (currentPosition + sizeof(uint32_t) + 8 >= data.size()) {
+						finishDemuxing();
+						return;
 					}
+					currentPosition += sizeof(uint32_t);
 					totalSize		  = collectElementSize();
+					segmentEnd		  = consumedSize + currentPosition + totalSize;
 					doWeHaveTotalSize = true;
 				}
-				while (currentPosition + 3 < data.size() && data.find(0xa3) != std::string::npos) {
-					if (currentPosition >= data.size() - 8) {
-						if ((totalSize > 0 && currentPosition >= totalSize)) {
-							areWeDoneVal = true;
-						}
-						return;
-					}
-					if (data.at(currentPosition) == SIMPLEBLOCK_ID && ((data.at(currentPosition + 2) == OPUS_TRACK_ID || data.at(currentPosition + 3) == OPUS_TRACK_ID))) {
-						++currentPosition;
-						if (currentSize == 0) {
-							currentSize = collectElementSize();
-							if (currentSize >= totalSize || currentSize >= 1276 || currentSize < 4) {
-								++currentPosition;
-								currentSize = 0;
-								continue;
-							} else if (currentSize == static_cast<uint64_t>(-1) || currentPosition + currentSize >= data.size()) {
-								if ((totalSize > 0 && currentPosition >= totalSize)) {
-									areWeDoneVal = true;
-								}
-								return;
-							} else {
-								parseOpusFrame();
-							}
+				while (currentPosition + 8 < data.size()) {
+					if (data[currentPosition] == SIMPLEBLOCK_ID && (data[currentPosition + 2] == OPUS_TRACK_ID || data[currentPosition + 3] == OPUS_TRACK_ID)) {
+						uint64_t blockPosition{ currentPosition++ };
+						currentSize = collectElementSize();
+						if (currentSize >= totalSize || currentSize >= 1276 || currentSize < 4) {
+							currentPosition = blockPosition + 1;
+						} else if (currentPosition + currentSize > data.size()) {
+							// The block is cut off by the end of the data, so it's parsed again once the rest of it has been written.
+							currentPosition = blockPosition;
+							break;
 						} else {
-							currentSize = 0;
+							parseOpusFrame();
 						}
 					} else {
-						++currentPosition;
+						auto nextBlockPosition = data.find(SIMPLEBLOCK_ID, currentPosition + 1);
+						currentPosition		   = nextBlockPosition != std::basic_string<uint8_t>::npos ? nextBlockPosition : data.size();
 					}
 				}
-				if ((totalSize > 0 && currentPosition >= totalSize)) {
-					areWeDoneVal = true;
-				}
-				return;
+				finishDemuxing();
 			}
 
 			/// @brief Checks if the demuxing process is complete.
@@ -140,25 +141,35 @@ namespace DiscordCoreAPI {
 			}
 
 		  protected:
-			std::basic_string_view<uint8_t> data{};///< Input data for demuxing.
+			std::basic_string<uint8_t> data{};///< The written data that has yet to be consumed.
 			std::deque<AudioFrameData> frames{};///< Queue to store collected frames.
+			bool areWeSearchingForSegment{ false };///< Flag indicating if the Segment is being searched for.
 			bool doWeHaveTotalSize{ false };///< Flag indicating if total size has been determined.
+			bool areWeAtEndOfStream{ false };///< Flag indicating if all of the data has been written.
 			bool areWeDoneVal{ false };///< Flag indicating if demuxing is complete.
 			uint64_t currentPosition{};///< Current position in the data.
+			uint64_t consumedSize{};///< The number of bytes consumed and dropped from the front of the data.
 			uint64_t currentSize{};///< Current size of the element being processed.
+			uint64_t segmentEnd{};///< The stream offset at which the segment ends.
 			uint64_t totalSize{};///< Total size of the segment.
 
-			/// @brief Finds the next occurrence of the specified value in the data.
+			/// @brief Drops the consumed data, and checks whether demuxing is complete.
+			inline void finishDemuxing() {
+				data.erase(0, currentPosition);
+				consumedSize += currentPosition;
+				currentPosition = 0;
+				if ((doWeHaveTotalSize && consumedSize >= segmentEnd) || areWeAtEndOfStream) {
+					areWeDoneVal = true;
+				}
+			}
+
+			/// @brief Finds the next occurrence of the specified value in the data, stopping in front of it.
 			/// @tparam ObjectType The type of value to search for.
 			/// @param value The value to search for.
 			/// @return True if the value was found, false otherwise.
 			template<typename ObjectType> inline bool findNextId(ObjectType value) {
-				if (currentPosition + sizeof(ObjectType) >= data.size()) {
-					return false;
-				}
-				while (currentPosition + sizeof(ObjectType) < data.size()) {
+				while (currentPosition + sizeof(ObjectType) <= data.size()) {
 					if (reverseBytes<ObjectType>() == value) {
-						currentPosition += sizeof(ObjectType);
 						return true;
 					}
 					++currentPosition;
@@ -170,11 +181,11 @@ namespace DiscordCoreAPI {
 			/// @tparam ObjectType The type of the current element.
 			/// @return The current element with reversed byte order.
 			template<typename ObjectType> inline ObjectType reverseBytes() {
-				if (data.size() <= currentPosition + sizeof(ObjectType)) {
+				if (data.size() < currentPosition + sizeof(ObjectType)) {
 					return static_cast<ObjectType>(-1);
 				}
 				ObjectType newValue{};
-				std::memcpy(&newValue, &data.at(currentPosition), sizeof(ObjectType));
+				std::memcpy(&newValue, data.data() + currentPosition, sizeof(ObjectType));
 				newValue = reverseByteOrder(newValue);
 				return newValue;
 			}
@@ -182,7 +193,7 @@ namespace DiscordCoreAPI {
 			/// @brief Collects the size of the current element being processed.
 			/// @return The size of the current element.
 			inline int64_t collectElementSize() {
-				if (currentPosition >= data.size() - 8) {
+				if (currentPosition + 8 >= data.size()) {
 					return -1;
 				}
 				return collectNumber();
@@ -193,13 +204,13 @@ namespace DiscordCoreAPI {
 			inline int64_t collectNumber() {
 				int32_t read{}, n{ 1 };
 				uint64_t total{};
-				total = static_cast<uint8_t>(data.at(currentPosition++));
+				total = static_cast<uint8_t>(data[currentPosition++]);
 
 				read = 8 - ffLog2Tab[total];
 
 				total ^= 1ull << ffLog2Tab[total];
 				while (n++ < read) {
-					total = (total << 8) | static_cast<uint8_t>(data.at(currentPosition++));
+					total = (total << 8) | static_cast<uint8_t>(data[currentPosition++]);
 				}
 				return static_cast<int64_t>(total);
 			}
@@ -216,103 +227,12 @@ namespace DiscordCoreAPI {
 			}
 		};
 
-		/// @brief A class representing an Opus packet.
-		class OpusPacket {
-		  public:
-			inline OpusPacket() = default;
-
-			/// @brief Constructor for OpusPacket.
-			/// @param newData The data for the Opus packet.
-			inline OpusPacket(Jsonifier::Vector<uint8_t> newData) {
-				dataVal = newData;
-			};
-
-			/// @brief Returns the size of the Opus packet data.
-			/// @return The size of the Opus packet data.
-			inline uint64_t size() {
-				return dataVal.size();
-			}
-
-			/// @brief Returns a pointer to the Opus packet data.
-			/// @return A pointer to the Opus packet data.
-			inline auto data() {
-				return dataVal.data();
-			}
-
-		  protected:
-			Jsonifier::Vector<uint8_t> dataVal{};///< The data for the Opus packet.
-		};
-
-		/// @brief A class representing an Ogg page for demuxing.
-		class OggPage {
-		  public:
-			/// @brief Constructor for OggPage.
-			/// @param newData The data for the Ogg page.
-			inline OggPage(Jsonifier::Vector<uint8_t>& newData) {
-				data = std::move(newData);
-				verifyAsOggPage();
-				getSegmentData();
-			}
-
-			/// @brief Retrieves the next Opus packet from the Ogg page.
-			/// @param newPacket Reference to store the retrieved Opus packet.
-			/// @return True if an Opus packet was retrieved, false otherwise.
-			inline bool getOpusPacket(OpusPacket& newPacket) {
-				if (segmentTable.size() > 0) {
-					auto newSpace = segmentTable.front();
-					segmentTable.pop_front();
-					Jsonifier::Vector<uint8_t> returnValue{};
-					returnValue.resize(newSpace);
-					std::memcpy(returnValue.data(), data.data() + currentPosition, newSpace);
-					currentPosition += newSpace;
-					newPacket = returnValue;
-					return true;
-				} else {
-					return false;
-				}
-			}
-
-			/// @brief Parses the segment data of the Ogg page.
-			inline void getSegmentData() {
-				segmentCount = data.at(26);
-				currentPosition += 27;
-				for (int32_t i{}; i < segmentCount; ++i) {
-					int32_t packetLength{ data.at(27ull + i) };
-					while (data.at(27ull + i) == 255) {
-						++i;
-						packetLength += data.at(27ull + i);
-					}
-					segmentTable.emplace_back(packetLength);
-				}
-				currentPosition += segmentCount;
-				return;
-			}
-
-			/// @brief Returns the size of the Ogg page data.
-			/// @return The size of the Ogg page data.
-			inline uint64_t getDataSize() {
-				return data.size();
-			}
-
-		  protected:
-			std::deque<int32_t> segmentTable{};///< Segment table storing Opus packet sizes.
-			Jsonifier::Vector<uint8_t> data{};///< The data for the Ogg page.
-			uint64_t totalPacketSize{};///< Total size of Opus packets in the page.
-			uint64_t currentPosition{};///< Current position in the page data.
-			int32_t segmentCount{};///< Number of segments in the Ogg page.
-
-			/// @brief Verifies that the data represents a valid Ogg page.
-			inline void verifyAsOggPage() {
-				while (data.at(currentPosition) != 'O' || data.at(currentPosition + 1) != 'g' || data.at(currentPosition + 2) != 'g' || data.at(currentPosition + 3) != 'S') {
-					++currentPosition;
-					if (currentPosition >= data.size()) {
-						return;
-					}
-				}
-			}
-		};
+		static constexpr uint64_t OGG_PAGE_HEADER_SIZE{ 27 };
+		static constexpr uint8_t OGG_CONTINUED_PACKET_FLAG{ 0x01 };
 
 		/// @brief A class for demuxing Ogg-contained audio data.
+		/// @details Data is pushed in as it arrives - only the bytes of a not-yet-complete page, and of a packet that continues onto the next page, are kept
+		/// between writes.
 		class OggDemuxer {
 		  public:
 			inline OggDemuxer() = default;
@@ -330,97 +250,80 @@ namespace DiscordCoreAPI {
 				}
 			}
 
-			/// @brief Writes data to the Ogg demuxer and processes it.
-			/// @param inputData The data to be written and processed.
+			/// @brief Writes data to the Ogg demuxer.
+			/// @param inputData The data to be written, which continues on from the previously written data.
 			inline void writeData(std::string_view inputData) {
-				uint64_t pos = 0;
-				data.clear();
-				data.resize(inputData.size());
-				std::memcpy(data.data(), inputData.data(), inputData.size());
-				uint64_t collectedLength{};
-				while (pos < inputData.size()) {
-					uint64_t oggPos = inputData.find("OggS", pos);
-					if (oggPos != std::string::npos) {
-						uint64_t nextOggPos = inputData.find("OggS", oggPos + 1);
-						if (nextOggPos != std::string::npos) {
-							collectedLength += nextOggPos - oggPos;
-							Jsonifier::Vector<uint8_t> newerString{};
-							newerString.resize(nextOggPos - oggPos);
-							std::memcpy(newerString.data(), data.data() + oggPos, nextOggPos - oggPos);
-							pages.emplace_back(newerString);
-							pos = nextOggPos;
-						} else {
-							Jsonifier::Vector<uint8_t> newerString{};
-							newerString.resize(inputData.size() - collectedLength);
-							std::memcpy(newerString.data(), data.data() + oggPos, inputData.size() - collectedLength);
-							pages.emplace_back(newerString);
-							pos = collectedLength;
-							break;
-						}
-					} else {
-						Jsonifier::Vector<uint8_t> newerString{};
-						newerString.resize(inputData.size() - collectedLength);
-						std::memcpy(newerString.data(), data.data() + oggPos, inputData.size() - collectedLength);
-						pages.emplace_back(newerString);
-						break;
-					}
-				}
-				return;
+				data.append(reinterpret_cast<const uint8_t*>(inputData.data()), inputData.size());
 			}
 
-			/// @brief Proceeds with the demuxing process.
-			/// @return True if demuxing is successful, false otherwise.
+			/// @brief Proceeds with the demuxing process, parsing every complete page that has been written.
+			/// @return True if at least one page was parsed, false otherwise.
 			inline bool proceedDemuxing() {
-				while (1) {
-					if (!processOggPage()) {
-						return false;
+				bool didWeParseAPage{};
+				while (findNextPage()) {
+					uint8_t segmentCount{ data[currentPosition + OGG_PAGE_HEADER_SIZE - 1] };
+					if (currentPosition + OGG_PAGE_HEADER_SIZE + segmentCount > data.size()) {
+						break;
+					}
+					const uint8_t* segmentTable{ data.data() + currentPosition + OGG_PAGE_HEADER_SIZE };
+					uint64_t bodySize{};
+					for (uint8_t x = 0; x < segmentCount; ++x) {
+						bodySize += segmentTable[x];
+					}
+					uint64_t bodyPosition{ currentPosition + OGG_PAGE_HEADER_SIZE + segmentCount };
+					if (bodyPosition + bodySize > data.size()) {
+						break;
+					}
+					if (!(data[currentPosition + 5] & OGG_CONTINUED_PACKET_FLAG)) {
+						packetData.clear();
 					}
+					for (uint8_t x = 0; x < segmentCount; ++x) {
+						packetData.append(data.data() + bodyPosition, segmentTable[x]);
+						bodyPosition += segmentTable[x];
+						if (segmentTable[x] < 255) {
+							processPacket();
+						}
+					}
+					currentPosition = bodyPosition;
+					didWeParseAPage = true;
 				}
-				return true;
+				data.erase(0, currentPosition);
+				currentPosition = 0;
+				return didWeParseAPage;
 			}
 
 		  protected:
 			std::deque<AudioFrameData> frames{};///< Queue to store collected audio frames.
-			std::deque<OpusPacket> packets{};///< Queue to store Opus packets.
-			Jsonifier::StringBase<uint8_t> data{};///< Input data for demuxing.
-			std::deque<OggPage> pages{};///< Queue to store Ogg pages.
-
-			/// @brief Processes an Ogg page for demuxing.
-			/// @return True if processing is successful, false if there are no more pages.
-			inline bool processOggPage() {
-				if (pages.empty()) {
-					return false;
-				}
-
-				processPages();
-				processPackets();
+			std::basic_string<uint8_t> packetData{};///< The packet being collected, which can span several pages.
+			std::basic_string<uint8_t> data{};///< The written data that has yet to be consumed.
+			uint64_t currentPosition{};///< Current position in the data.
 
-				return true;
+			/// @brief Skips ahead to the next page's capture pattern, stopping once its header has been written.
+			/// @return True if a whole page header is available at the current position, false otherwise.
+			inline bool findNextPage() {
+				while (currentPosition + OGG_PAGE_HEADER_SIZE <= data.size()) {
+					if (data[currentPosition] == 'O' && data[currentPosition + 1] == 'g' && data[currentPosition + 2] == 'g' && data[currentPosition + 3] == 'S') {
+						return true;
+					}
+					auto nextPagePosition = data.find(static_cast<uint8_t>('O'), currentPosition + 1);
+					currentPosition		  = nextPagePosition != std::basic_string<uint8_t>::npos ? nextPagePosition : data.size();
+				}
+				return false;
 			}
 
-			/// @brief Processes Opus packets extracted from Ogg pages.
-			inline void processPackets() {
-				while (!packets.empty()) {
-					OpusPacket newPacket = packets.front();
-					packets.pop_front();
+			/// @brief Turns a completed packet into an audio frame, skipping the OpusHead and OpusTags headers.
+			inline void processPacket() {
+				std::basic_string_view<uint8_t> packet{ packetData };
+				bool isItAHeader{ packet.size() >= 8 &&
+					(std::memcmp(packet.data(), "OpusHead", 8) == 0 || std::memcmp(packet.data(), "OpusTags", 8) == 0) };
+				if (packet.size() > 0 && !isItAHeader) {
 					AudioFrameData newFrame{};
-					newFrame += std::basic_string_view<uint8_t>{ newPacket.data(), newPacket.size() };
-					newFrame.currentSize = newPacket.size();
+					newFrame += packet;
+					newFrame.currentSize = packet.size();
 					newFrame.type		 = AudioFrameType::Encoded;
 					frames.emplace_back(std::move(newFrame));
 				}
-			}
-
-			/// @brief Processes Ogg pages to extract Opus packets.
-			inline void processPages() {
-				while (!pages.empty()) {
-					OggPage page = pages.front();
-					pages.pop_front();
-					OpusPacket newPacket{};
-					while (page.getOpusPacket(newPacket)) {
-						packets.emplace_back(newPacket);
-					}
-				}
+				packetData.clear();
 			}
 		};
 
@@ -154,6 +154,60 @@ namespace DiscordCoreAPI {
 				return std::string_view{ finalString.data(), currentSize };
 			}
 
+			/// @brief Parse ETF data to JSON format, collecting the op/s/t envelope fields and the span of "d" while walking the top-level map.
+			/// @tparam MessageType The envelope type to fill, exposing op, s and t members.
+			/// @param dataToParse The ETF data to be parsed.
+			/// @param message The envelope to fill from the top-level map.
+			/// @param payload Set to the JSON of the top-level "d" value, left empty if there is none.
+			/// @return The JSON representation of the parsed data.
+			template<typename MessageType>
+			inline std::string_view parseEtfToJson(std::string_view dataToParse, MessageType& message, std::string_view& payload) {
+				dataBuffer = dataToParse.data();
+				dataSize   = dataToParse.size();
+				finalString.clear();
+				currentSize = 0;
+				offSet		= 0;
+				if (readBitsFromBuffer<uint8_t>() != formatVersion) {
+					throw EtfParseError{ "EtfParser::parseEtfToJson() Error: Incorrect format version specified." };
+				}
+				if (offSet >= dataSize || static_cast<EtfType>(dataBuffer[offSet]) != EtfType::Map_Ext) {
+					singleValueETFToJson();
+					return std::string_view{ finalString.data(), currentSize };
+				}
+				++offSet;
+				uint32_t length = readBitsFromBuffer<uint32_t>();
+				uint64_t payloadStart{};
+				uint64_t payloadEnd{};
+				writeCharacter('{');
+				for (uint32_t x = 0; x < length; ++x) {
+					uint64_t keyStart{ currentSize };
+					singleValueETFToJson();
+					uint64_t keyEnd{ currentSize };
+					writeCharacter(':');
+					uint64_t valueStart{ currentSize };
+					singleValueETFToJson();
+					std::string_view key{ finalString.data() + keyStart, keyEnd - keyStart };
+					std::string_view value{ finalString.data() + valueStart, currentSize - valueStart };
+					if (key == "\"op\"") {
+						std::from_chars(value.data(), value.data() + value.size(), message.op);
+					} else if (key == "\"s\"") {
+						std::from_chars(value.data(), value.data() + value.size(), message.s);
+					} else if (key == "\"t\"" && value.size() >= 2 && value.front() == '"') {
+						message.t = value.substr(1, value.size() - 2);
+					} else if (key == "\"d\"") {
+						payloadStart = valueStart;
+						payloadEnd	 = currentSize;
+					}
+					if (x < length - 1) {
+						writeCharacter(',');
+					}
+				}
+				writeCharacter('}');
+				// Only taken once the map is written, as finalString may be reallocated while it grows.
+				payload = std::string_view{ finalString.data() + payloadStart, payloadEnd - payloadStart };
+				return std::string_view{ finalString.data(), currentSize };
+			}
+
 		  protected:
 			Jsonifier::String finalString{};///< The final JSON string.
 			const char* dataBuffer{};///< Pointer to ETF data buffer.
@@ -271,6 +325,15 @@ namespace DiscordCoreAPI {
 				writeCharacter('"');
 			}
 
+			/// @brief Write an integer to the final JSON string without a temporary string allocation.
+			/// @tparam ValueType The integer type to write.
+			/// @param value The integer to write.
+			template<typename ValueType> inline void writeNumber(ValueType value) {
+				char buffer[24]{};
+				auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+				writeCharacters(buffer, static_cast<uint64_t>(result.ptr - buffer));
+			}
+
 			/// @brief Write a character to the final JSON string.
 			/// @param value The character to write.
 			inline void writeCharacter(const char value) {
@@ -345,14 +408,12 @@ namespace DiscordCoreAPI {
 
 			/// @brief Parse ETF data representing a small integer and convert to JSON number.
 			inline void parseSmallIntegerExt() {
-				auto string = std::to_string(readBitsFromBuffer<uint8_t>());
-				writeCharacters(string.data(), string.size());
+				writeNumber(readBitsFromBuffer<uint8_t>());
 			}
 
 			/// @brief Parse ETF data representing an integer and convert to JSON number.
 			inline void parseIntegerExt() {
-				auto string = std::to_string(readBitsFromBuffer<uint32_t>());
-				writeCharacters(string.data(), string.size());
+				writeNumber(readBitsFromBuffer<int32_t>());
 			}
 
 			/// @brief Parse ETF data representing a string and convert to JSON string.
@@ -397,14 +458,11 @@ namespace DiscordCoreAPI {
 				}
 
 				if (sign == 0) {
-					auto string = std::to_string(value);
-					writeCharacters(string.data(), string.size());
-					writeCharacter('"');
+					writeNumber(value);
 				} else {
-					auto string = std::to_string(-(static_cast<int64_t>(value)));
-					writeCharacters(string.data(), string.size());
-					writeCharacter('"');
+					writeNumber(-(static_cast<int64_t>(value)));
 				}
+				writeCharacter('"');
 			}
 
 			/// @brief Parse ETF data representing an atom and convert to JSON string.
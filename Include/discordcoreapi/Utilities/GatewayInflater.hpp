@@ -0,0 +1,80 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GatewayInflater.hpp - Header file for the GatewayInflater class.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file GatewayInflater.hpp
+
+#pragma once
+
+#include <discordcoreapi/Utilities/UniquePtr.hpp>
+#include <discordcoreapi/Utilities/Base.hpp>
+
+struct z_stream_s;
+
+namespace DiscordCoreAPI {
+
+	namespace DiscordCoreInternal {
+
+		/**
+		 * \addtogroup discord_core_internal
+		 * @{
+		 */
+
+		/// @brief Inflates a gateway connection's zlib-stream transport compression.
+		/// @details The gateway compresses every payload of a connection with one shared zlib context, flushing it after each payload, so a single
+		/// inflate context has to live as long as the connection does.
+		class DiscordCoreAPI_Dll GatewayInflater {
+		  public:
+			GatewayInflater() noexcept;
+
+			GatewayInflater& operator=(GatewayInflater&&) noexcept;
+			GatewayInflater(GatewayInflater&&) noexcept;
+
+			/// @brief Whether the library was built with zlib.
+			/// @return `true` if zlib-stream compression can be requested.
+			static bool isItSupported();
+
+			/// @brief Starts a fresh inflate context, for a new connection.
+			void reset();
+
+			/// @brief Feeds the inflater a gateway message.
+			/// @param data The compressed message.
+			/// @param outData Set to a view of the inflated payload, which stays valid until the next call.
+			/// @return `true` once a whole payload has been inflated, `false` if the payload continues in a later message.
+			bool inflate(std::string_view data, std::string_view& outData);
+
+			~GatewayInflater() noexcept;
+
+		  protected:
+			UniquePtr<z_stream_s> stream{};
+			std::string pendingBuffer{};
+			std::string outputBuffer{};
+		};
+
+		/**@}*/
+	}
+}
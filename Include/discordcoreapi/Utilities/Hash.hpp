@@ -79,9 +79,15 @@ namespace DiscordCoreAPI {
 
 	class TwoIdKey {
 	  public:
+		inline TwoIdKey() = default;
+
 		template<GuildMemberT ValueType> TwoIdKey(const ValueType& other);
 		template<VoiceStateT ValueType> TwoIdKey(const ValueType& other);
 
+		inline bool operator==(const TwoIdKey& other) const {
+			return idOne == other.idOne && idTwo == other.idTwo;
+		}
+
 		Snowflake idOne{};
 		Snowflake idTwo{};
 	};
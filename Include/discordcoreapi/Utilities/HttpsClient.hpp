@@ -152,6 +152,7 @@ namespace DiscordCoreAPI {
 		};
 
 		struct RateLimitData {
+			friend class HttpsRequestScheduler;
 			friend class RateLimitStackHolder;
 			friend class HttpsConnectionManager;
 			friend class HttpsRnRBuilder;
@@ -159,22 +160,27 @@ namespace DiscordCoreAPI {
 
 		  protected:
 			std::atomic<Milliseconds> sampledTimeInMs{ Milliseconds{} };
-			std::counting_semaphore<1> theSemaphore{ 1 };
+			std::condition_variable conditionVariable{};
 			std::atomic<Seconds> sRemain{ Seconds{} };
 			std::atomic_bool areWeASpecialBucket{};
 			std::atomic_bool didWeHitRateLimit{};
 			std::atomic_int64_t getsRemaining{};
 			std::atomic_bool haveWeGoneYet{};
+			int64_t currentRequestCount{};
 			std::atomic_bool doWeWait{};
+			Milliseconds resumeTime{};
 			std::string tempBucket{};
+			std::mutex accessMutex{};
 			std::string bucket{};
+
+			int64_t getMaxRequestCount(int64_t maxRequestsPerBucket);
 		};
 
 		class HttpsConnection : public HttpsRnRBuilder {
 		  public:
+			friend class HttpsConnectionPool;
 			friend class HttpsTCPConnection;
 
-			std::counting_semaphore<1> theSemaphore{ 1 };
 			const int32_t maxReconnectTries{ 3 };
 			Jsonifier::String inputBufferReal{};
 			HttpsTCPConnection tcpConnection{};
@@ -185,49 +191,119 @@ namespace DiscordCoreAPI {
 
 			HttpsConnection() = default;
 
-			void resetValues(HttpsWorkloadData&& workloadNew);
+			void resetValues(HttpsWorkloadData&& workload);
 
 			bool areWeConnected();
 
 			void disconnect();
 
 			virtual ~HttpsConnection() = default;
+
+		  protected:
+			Milliseconds lastTimeUsed{};
+			bool areWeInUse{};
+		};
+
+		/// @brief A pool of keep-alive Https connections, which are collected and reused on a per-host basis.
+		class HttpsConnectionPool {
+		  public:
+			HttpsConnectionPool() = default;
+
+			HttpsConnection& acquireConnection(const std::string& baseUrl);
+
+			void releaseConnection(HttpsConnection& connection);
+
+			void setOptions(const HttpsOptions& optionsNew);
+
+			HttpsOptions getOptions();
+
+		  protected:
+			UnorderedMap<std::string, Jsonifier::Vector<UniquePtr<HttpsConnection>>> connections{};
+			std::condition_variable conditionVariable{};
+			HttpsOptions options{};
+			std::mutex accessMutex{};
+
+			void pruneIdleConnections(Jsonifier::Vector<UniquePtr<HttpsConnection>>& hostConnections);
+
+			static std::string getHost(const std::string& baseUrl);
+		};
+
+		/// @brief Holds Https requests until their turn within their workload type, and until their rate-limit bucket resets, without polling.
+		/// @details Requests are still synchronous: a waiting request blocks its calling thread on a condition variable until it is signalled, rather than
+		/// being suspended and resumed. One timer thread drives every bucket's reset.
+		class HttpsRequestScheduler {
+		  public:
+			HttpsRequestScheduler();
+
+			/// @brief Blocks until every earlier request of the same workload type has been admitted.
+			/// @param workload The workload that is waiting for its turn.
+			void waitForTurn(const HttpsWorkloadData& workload);
+
+			/// @brief Admits the next request of the given workload type.
+			/// @param workloadType The workload type to advance.
+			void advanceTurn(HttpsWorkloadType workloadType);
+
+			/// @brief Blocks the calling thread on the bucket's condition variable until the timer thread signals it at the given time.
+			/// @param rateLimitData The rate-limit bucket to wait on.
+			/// @param targetTime The time since epoch at which the bucket frees.
+			void waitForBucket(RateLimitData& rateLimitData, Milliseconds targetTime);
+
+			~HttpsRequestScheduler();
+
+		  protected:
+			struct TimerData {
+				RateLimitData* rateLimitData{};
+				Milliseconds targetTime{};
+
+				inline bool operator>(const TimerData& other) const {
+					return targetTime > other.targetTime;
+				}
+			};
+
+			std::array<std::condition_variable, static_cast<uint64_t>(HttpsWorkloadType::LAST)> workloadConditions{};
+			std::priority_queue<TimerData, std::vector<TimerData>, std::greater<TimerData>> timers{};
+			std::condition_variable timerCondition{};
+			std::mutex accessMutex{};
+			ThreadWrapper timerThread{};
+
+			void runTimers(StopToken stopToken);
 		};
 
 		class HttpsConnectionManager {
 		  public:
+			friend class RateLimitStackHolder;
 			friend class HttpsClient;
 
 			HttpsConnectionManager() = default;
 
-			HttpsConnection& getConnection(HttpsWorkloadType workloadType);
-
 			RateLimitData& getRateLimitData(HttpsWorkloadType workloadType);
 
-			void initialize();
+			void initialize(const HttpsOptions& optionsNew);
 
 		  protected:
-			UnorderedMap<HttpsWorkloadType, UniquePtr<HttpsConnection>> httpsConnections{};
 			UnorderedMap<std::string, UniquePtr<RateLimitData>> rateLimitValues{};
 			UnorderedMap<HttpsWorkloadType, std::string> rateLimitValueBuckets{};
+			HttpsRequestScheduler requestScheduler{};
+			int64_t maxRequestsPerBucket{ 1 };
 			std::mutex accessMutex{};
 		};
 
 		class HttpsConnectionStackHolder {
 		  public:
-			HttpsConnectionStackHolder(HttpsConnectionManager& connectionManager, HttpsWorkloadData&& workload);
+			HttpsConnectionStackHolder(HttpsConnectionPool& connectionPool, HttpsWorkloadData&& workload);
 
 			HttpsConnection& getConnection();
 
 			~HttpsConnectionStackHolder();
 
 		  protected:
+			HttpsConnectionPool* connectionPool{};
 			HttpsConnection* connection{};
 		};
 
 		class RateLimitStackHolder {
 		  public:
-			RateLimitStackHolder(HttpsConnectionManager& connectionManager, HttpsWorkloadType workload);
+			RateLimitStackHolder(HttpsConnectionManager& connectionManager, const HttpsWorkloadData& workload);
 
 			RateLimitData& getRateLimitData();
 
@@ -245,9 +321,9 @@ namespace DiscordCoreAPI {
 			HttpsClientCore(const std::string& botTokenNew);
 
 			inline HttpsResponseData submitWorkloadAndGetResult(HttpsWorkloadData&& workloadNew) {
-				HttpsConnection connection{};
+				HttpsConnectionStackHolder stackHolder{ connectionPool, std::move(workloadNew) };
+				auto& connection = stackHolder.getConnection();
 				RateLimitData rateLimitData{};
-				connection.resetValues(std::move(workloadNew));
 				auto returnData = httpsRequestInternal(connection, rateLimitData);
 				if (returnData.responseCode != 200 && returnData.responseCode != 204 && returnData.responseCode != 201) {
 					std::string errorMessage{};
@@ -272,6 +348,7 @@ namespace DiscordCoreAPI {
 			}
 
 		  protected:
+			inline static HttpsConnectionPool connectionPool{};
 			std::string botToken{};
 
 			HttpsResponseData httpsRequestInternal(HttpsConnection& connection, RateLimitData& rateLimitData);
@@ -281,14 +358,77 @@ namespace DiscordCoreAPI {
 			HttpsResponseData getResponse(HttpsConnection& connection, RateLimitData& rateLimitData);
 		};
 
+		/// @brief A small, fixed set of threads that runs Song range requests, apart from the CoRoutine thread pool.
+		/// @details The downloaders that wait on these requests each hold a pool thread for a whole Song, so were the requests to run on the pool as well,
+		/// enough concurrently streaming Guilds could leave none of its threads free to run them.
+		class HttpsRangeExecutor {
+		  public:
+			/// @brief Queues a job, starting the threads on first use.
+			/// @param job The job to run.
+			void submit(std::function<void()>&& job);
+
+			~HttpsRangeExecutor();
+
+		  protected:
+			Jsonifier::Vector<ThreadWrapper> threads{};
+			std::deque<std::function<void()>> jobs{};
+			std::condition_variable conditionVariable{};
+			std::mutex accessMutex{};
+
+			void run(StopToken stopToken);
+		};
+
+		/// @brief Downloads a Song's range requests ahead of their collection, keeping several of them in flight over the pooled keep-alive connections.
+		/// @details Each range is requested on the shared HttpsRangeExecutor, started only once it is within StreamingOptions::maxRequestsInFlight ranges of
+		/// the last one collected - so how far the download runs ahead of playback is bounded by how far ahead the collector lets it.
+		class DiscordCoreAPI_Dll HttpsRangePrefetcher {
+		  public:
+			/// @brief Starts downloading the ranges.
+			/// @param clientNew The client to submit the range requests through.
+			/// @param workloadsNew The range requests, in playback order.
+			/// @param options How many requests to keep in flight at once.
+			HttpsRangePrefetcher(HttpsClientCore& clientNew, Jsonifier::Vector<HttpsWorkloadData>&& workloadsNew, const StreamingOptions& options);
+
+			/// @brief Waits for the next range, in playback order, and rethrows the error it failed with, if any.
+			/// @param responseData Set to the range's response.
+			/// @return `true` if a range was collected, `false` once every range has been.
+			bool collectResponse(HttpsResponseData& responseData);
+
+			~HttpsRangePrefetcher();
+
+		  protected:
+			struct RangeData {
+				HttpsResponseData responseData{};
+				std::exception_ptr error{};
+				bool isItComplete{};
+			};
+
+			inline static HttpsRangeExecutor executor{};
+			Jsonifier::Vector<HttpsWorkloadData> workloads{};
+			std::condition_variable conditionVariable{};
+			std::deque<RangeData> ranges{};
+			HttpsClientCore* client{};
+			uint64_t collectedIndex{};
+			uint64_t runningCount{};
+			uint64_t rangesAhead{};
+			uint64_t nextIndex{};
+			std::mutex accessMutex{};
+			bool areWeStopping{};
+
+			void runRequest(uint64_t index);
+
+			void startRanges();
+		};
+
 		class DiscordCoreAPI_Dll HttpsClient : public HttpsClientCore {
 		  public:
-			HttpsClient(const std::string& botTokenNew);
+			HttpsClient(const std::string& botTokenNew, const HttpsOptions& optionsNew);
 
 			template<typename... Args> void submitWorkloadAndGetResult(HttpsWorkloadData&& workload, Args&... args) {
-				HttpsConnectionStackHolder stackHolder{ connectionManager, std::move(workload) };
+				RateLimitStackHolder rateLimitStackHolder{ connectionManager, workload };
+				HttpsConnectionStackHolder stackHolder{ connectionPool, std::move(workload) };
 				auto& connection				= stackHolder.getConnection();
-				HttpsResponseData returnDataNew = httpsRequest(connection);
+				HttpsResponseData returnDataNew = executeByRateLimitData(connection, rateLimitStackHolder.getRateLimitData());
 
 				if (static_cast<uint32_t>(returnDataNew.responseCode) != 200 && static_cast<uint32_t>(returnDataNew.responseCode) != 204 &&
 					static_cast<uint32_t>(returnDataNew.responseCode) != 201) {
@@ -322,8 +462,6 @@ namespace DiscordCoreAPI {
 			HttpsConnectionManager connectionManager{};
 
 			HttpsResponseData executeByRateLimitData(HttpsConnection& connection, RateLimitData& rateLimitData);
-
-			HttpsResponseData httpsRequest(HttpsConnection& connection);
 		};
 
 	}// namespace DiscordCoreInternal
@@ -49,76 +49,6 @@ namespace DiscordCoreAPI {
 		using AvxFloat	  = __m128;
 		using AvxInt	  = __m128i;
 
-		/// @brief Extracts a 32-bit integer from a 128-bit AVX2 register.
-		/// @param value The AVX2 register containing packed 16-bit integers.
-		/// @param index The index of the 32-bit integer to extract (0-3).
-		/// @return The extracted 32-bit integer.
-		inline int32_t extractInt32FromAvx(const AvxInt& value, int64_t index) {
-			switch (index) {
-				case 0: {
-					return _mm_extract_epi32(value, 0);
-				}
-				case 1: {
-					return _mm_extract_epi32(value, 1);
-				}
-				case 2: {
-					return _mm_extract_epi32(value, 2);
-				}
-				case 3: {
-					return _mm_extract_epi32(value, 3);
-				}
-				default: {
-					return _mm_extract_epi32(value, 0);
-				}
-			}
-		}
-
-		/// @brief Extracts a 32-bit integer from a 256-bit AVX2 register.
-		/// @param value The AVX2 register containing packed 32-bit integers.
-		/// @param index The index of the 32bit integer to extract (0-7).
-		/// @return The extracted 32-bit integer.
-		inline int32_t extractInt32FromAvx2(const Avx2Int& value, int64_t index) {
-			switch (index) {
-				case 0: {
-					return _mm256_extract_epi32(value, 0);
-				}
-				case 1: {
-					return _mm256_extract_epi32(value, 1);
-				}
-				case 2: {
-					return _mm256_extract_epi32(value, 2);
-				}
-				case 3: {
-					return _mm256_extract_epi32(value, 3);
-				}
-				case 4: {
-					return _mm256_extract_epi32(value, 4);
-				}
-				case 5: {
-					return _mm256_extract_epi32(value, 5);
-				}
-				case 6: {
-					return _mm256_extract_epi32(value, 6);
-				}
-				case 7: {
-					return _mm256_extract_epi32(value, 7);
-				}
-				default: {
-					return _mm256_extract_epi32(value, 0);
-				}
-			}
-		}
-
-		/// @brief Extracts a 32-bit integer from a 512-bit AVX-512 register.
-		/// @param value The AVX-512 register containing packed 16-bit integers.
-		/// @param index The index of the 32-bit integer to extract (0-15).
-		/// @return The extracted 32-bit integer.
-		inline int32_t extractInt32FromAvx512(const Avx512Int& value, int64_t index) {
-			alignas(64) int32_t result[16];
-			_mm512_store_si512(result, value);
-			return result[index];
-		}
-
 #ifdef T_AVX512
 
 		/// @brief A class for audio mixing operations using AVX512 instructions.
@@ -127,52 +57,29 @@ namespace DiscordCoreAPI {
 			/// @brief The number of 32-bit values per CPU register.
 			static constexpr int32_t byteBlocksPerRegister{ 16 };
 
-			/// @brief Stores values from a 512-bit AVX vector to a storage location.
-			/// @tparam ValueType The target value type for storage.
-			/// @param valuesToStore The 512-bit AVX vector containing values to store.
-			/// @param storageLocation Pointer to the storage location.
-			template<typename ValueType> inline static void storeValues(const Avx512Int& valuesToStore, ValueType* storageLocation) {
-				for (int64_t x = 0; x < byteBlocksPerRegister; ++x) {
-					storageLocation[x] = static_cast<ValueType>(extractInt32FromAvx512(valuesToStore, x));
-				}
-			}
-
-			/// @brief Specialization for gathering non-float values into an AVX register.
-			/// @tparam ValueType The type of values being gathered.
-			/// @param values The values to gather.
-			/// @return An AVX register containing gathered values.
-			template<typename ValueType> inline static Avx512Float gatherValues(ValueType* values) {
-				float newArray[byteBlocksPerRegister]{};
-				for (uint64_t x = 0; x < byteBlocksPerRegister; ++x) {
-					newArray[x] = static_cast<float>(values[x]);
-				}
-				return _mm512_loadu_ps(newArray);
-			}
-
 			/// @brief Collect a single register worth of data from dataIn, apply gain and increment, and store the result in dataOut. This version uses AVX512 instructions.
 			/// @param dataIn Pointer to the input array of int32_t values.
 			/// @param dataOut Pointer to the output array of int16_t values.
 			/// @param currentGain The gain to be applied to the elements.
 			/// @param increment The increment value to be added to each element.
 			inline static void collectSingleRegister(int32_t* dataIn, int16_t* dataOut, float currentGain, float increment) {
-				Avx512Float currentSamplesNew{ _mm512_mul_ps(gatherValues(dataIn),
+				Avx512Float currentSamplesNew{ _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_loadu_si512(dataIn)),
 					_mm512_add_ps(_mm512_set1_ps(currentGain),
 						_mm512_mul_ps(_mm512_set1_ps(increment),
-							_mm512_set_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f)))) };
+							_mm512_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f)))) };
 
-				currentSamplesNew = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(currentSamplesNew, _mm512_set1_ps(0.0f), _CMP_GE_OQ),
-					_mm512_max_ps(currentSamplesNew, _mm512_set1_ps(static_cast<float>(std::numeric_limits<opus_int16>::min()))),
-					_mm512_min_ps(currentSamplesNew, _mm512_set1_ps(static_cast<float>(std::numeric_limits<opus_int16>::max()))));
+				currentSamplesNew = _mm512_min_ps(_mm512_max_ps(currentSamplesNew, _mm512_set1_ps(static_cast<float>(std::numeric_limits<int16_t>::min()))),
+					_mm512_set1_ps(static_cast<float>(std::numeric_limits<int16_t>::max())));
 
-				storeValues(_mm512_cvtps_epi32(currentSamplesNew), dataOut);
+				_mm256_storeu_si256(reinterpret_cast<Avx2Int*>(dataOut), _mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(currentSamplesNew)));
 			}
 
-			/// @brief Combine a register worth of elements from decodedData and store the result in upSampledVector. This version uses AVX51 instructions.
+			/// @brief Combine a register worth of elements from decodedData and store the result in upSampledVector. This version uses AVX512 instructions.
 			/// @param upSampledVector Pointer to the array of int32_t values.
 			/// @param decodedData Pointer to the array of int16_t values.
 			inline static void combineSamples(int32_t* upSampledVector, const int16_t* decodedData) {
-				auto newValues{ _mm512_cvtps_epi32(_mm512_add_ps(gatherValues(upSampledVector), gatherValues(decodedData))) };
-				storeValues(newValues, upSampledVector);
+				Avx512Int newValues{ _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const Avx2Int*>(decodedData))) };
+				_mm512_storeu_si512(upSampledVector, _mm512_add_epi32(_mm512_loadu_si512(upSampledVector), newValues));
 			}
 		};
 
@@ -184,117 +91,86 @@ namespace DiscordCoreAPI {
 			/// @brief The number of 32-bit values per CPU register.
 			static constexpr int32_t byteBlocksPerRegister{ 8 };
 
-			/// @brief Stores values from a 256-bit AVX vector to a storage location.
-			/// @tparam ValueType The target value type for storage.
-			/// @param valuesToStore The 256-bit AVX vector containing values to store.
-			/// @param storageLocation Pointer to the storage location.
-			template<typename ValueType> inline static void storeValues(const Avx2Int& valuesToStore, ValueType* storageLocation) {
-				for (int64_t x = 0; x < byteBlocksPerRegister; ++x) {
-					storageLocation[x] = static_cast<ValueType>(extractInt32FromAvx2(valuesToStore, x));
-				}
-			}
-
-			/// @brief Specialization for gathering non-float values into an AVX register.
-			/// @tparam ValueType The type of values being gathered.
-			/// @param values The values to gather.
-			/// @return An AVX register containing gathered values.
-			template<typename ValueType> inline static Avx2Float gatherValues(ValueType* values) {
-				float newArray[byteBlocksPerRegister]{};
-				for (uint64_t x = 0; x < byteBlocksPerRegister; ++x) {
-					newArray[x] = static_cast<float>(values[x]);
-				}
-				return _mm256_loadu_ps(newArray);
-			}
-
 			/// @brief Collect a single register worth of data from dataIn, apply gain and increment, and store the result in dataOut. This version uses AVX2 instructions.
 			/// @param dataIn Pointer to the input array of int32_t values.
 			/// @param dataOut Pointer to the output array of int16_t values.
 			/// @param currentGain The gain to be applied to the elements.
 			/// @param increment The increment value to be added to each element.
 			inline static void collectSingleRegister(int32_t* dataIn, int16_t* dataOut, float currentGain, float increment) {
-				Avx2Float currentSamplesNew{ _mm256_mul_ps(gatherValues(dataIn),
-					_mm256_add_ps(_mm256_set1_ps(currentGain), _mm256_mul_ps(_mm256_set1_ps(increment), _mm256_set_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f)))) };
+				Avx2Float currentSamplesNew{ _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const Avx2Int*>(dataIn))),
+					_mm256_add_ps(_mm256_set1_ps(currentGain), _mm256_mul_ps(_mm256_set1_ps(increment), _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f)))) };
 
-				currentSamplesNew = _mm256_blendv_ps(_mm256_max_ps(currentSamplesNew, _mm256_set1_ps(static_cast<float>(std::numeric_limits<opus_int16>::min()))),
-					_mm256_min_ps(currentSamplesNew, _mm256_set1_ps(static_cast<float>(std::numeric_limits<opus_int16>::max()))),
-					_mm256_cmp_ps(currentSamplesNew, _mm256_set1_ps(0.0f), _CMP_GE_OQ));
+				currentSamplesNew = _mm256_min_ps(_mm256_max_ps(currentSamplesNew, _mm256_set1_ps(static_cast<float>(std::numeric_limits<int16_t>::min()))),
+					_mm256_set1_ps(static_cast<float>(std::numeric_limits<int16_t>::max())));
 
-				storeValues(_mm256_cvtps_epi32(currentSamplesNew), dataOut);
+				// packs_epi32 works within each 128-bit lane, so the low quadword of each lane is gathered back into the lower half.
+				Avx2Int packedSamples{ _mm256_packs_epi32(_mm256_cvtps_epi32(currentSamplesNew), _mm256_setzero_si256()) };
+				_mm_storeu_si128(reinterpret_cast<AvxInt*>(dataOut), _mm256_castsi256_si128(_mm256_permute4x64_epi64(packedSamples, 0b11011000)));
 			}
 
 			/// @brief Combine a register worth of elements from decodedData and store the result in upSampledVector. This version uses AVX2 instructions.
 			/// @param upSampledVector Pointer to the array of int32_t values.
 			/// @param decodedData Pointer to the array of int16_t values.
 			inline static void combineSamples(int32_t* upSampledVector, const int16_t* decodedData) {
-				auto newValues{ _mm256_cvtps_epi32(_mm256_add_ps(gatherValues(upSampledVector), gatherValues(decodedData))) };
-				storeValues(newValues, upSampledVector);
+				Avx2Int newValues{ _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const AvxInt*>(decodedData))) };
+				_mm256_storeu_si256(reinterpret_cast<Avx2Int*>(upSampledVector),
+					_mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const Avx2Int*>(upSampledVector)), newValues));
 			}
 		};
 
-#elif T_AVX
+#elif T_AVX || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
 
-		/// @brief A class for audio mixing operations using AVX instructions.
+		/// @brief A class for audio mixing operations using AVX instructions, or SSE2 instructions where AVX is unavailable.
 		class AudioMixer {
 		  public:
 			/// @brief The number of 32-bit values per CPU register.
 			static constexpr int32_t byteBlocksPerRegister{ 4 };
 
-			/// @brief Stores values from a 128-bit AVX vector to a storage location.
-			/// @tparam ValueType The target value type for storage.
-			/// @param valuesToStore The 128-bit AVX vector containing values to store.
-			/// @param storageLocation Pointer to the storage location.
-			template<typename ValueType> inline static void storeValues(const AvxInt& valuesToStore, ValueType* storageLocation) {
-				for (int64_t x = 0; x < byteBlocksPerRegister; ++x) {
-					storageLocation[x] = static_cast<ValueType>(extractInt32FromAvx(valuesToStore, x));
-				}
-			}
-
-			/// @brief Specialization for gathering non-float values into an AVX register.
-			/// @tparam ValueType The type of values being gathered.
-			/// @param values The values to gather.
-			/// @return An AVX register containing gathered values.
-			template<typename ValueType> inline static AvxFloat gatherValues(ValueType* values) {
-				float newArray[byteBlocksPerRegister]{};
-				for (uint64_t x = 0; x < byteBlocksPerRegister; ++x) {
-					newArray[x] = static_cast<float>(values[x]);
-				}
-				return _mm_loadu_ps(newArray);
+			/// @brief Sign-extends four 16-bit integers into a register of 32-bit integers.
+			/// @param values Pointer to the 16-bit integers.
+			/// @return A register containing the widened values.
+			inline static AvxInt widenValues(const int16_t* values) {
+#if T_AVX
+				return _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const AvxInt*>(values)));
+#else
+				AvxInt newValues{ _mm_loadl_epi64(reinterpret_cast<const AvxInt*>(values)) };
+				return _mm_srai_epi32(_mm_unpacklo_epi16(newValues, newValues), 16);
+#endif
 			}
 
-			/// @brief Collect a single register worth of data from dataIn, apply gain and increment, and store the result in dataOut. This version uses AVX instructions.
+			/// @brief Collect a single register worth of data from dataIn, apply gain and increment, and store the result in dataOut. This version uses AVX or SSE2 instructions.
 			/// @param dataIn Pointer to the input array of int32_t values.
 			/// @param dataOut Pointer to the output array of int16_t values.
 			/// @param currentGain The gain to be applied to the elements.
 			/// @param increment The increment value to be added to each element.
 			inline static void collectSingleRegister(int32_t* dataIn, int16_t* dataOut, float currentGain, float increment) {
-				AvxFloat currentSamplesNew{ _mm_mul_ps(gatherValues(dataIn),
-					_mm_add_ps(_mm_set1_ps(currentGain), _mm_mul_ps(_mm_set1_ps(increment), _mm_set_ps(0.0f, 1.0f, 2.0f, 3.0f)))) };
+				AvxFloat currentSamplesNew{ _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const AvxInt*>(dataIn))),
+					_mm_add_ps(_mm_set1_ps(currentGain), _mm_mul_ps(_mm_set1_ps(increment), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f)))) };
 
-				currentSamplesNew = _mm_blendv_ps(_mm_max_ps(currentSamplesNew, _mm_set1_ps(static_cast<float>(std::numeric_limits<opus_int16>::min()))),
-					_mm_min_ps(currentSamplesNew, _mm_set1_ps(static_cast<float>(std::numeric_limits<opus_int16>::max()))),
-					_mm_cmp_ps(currentSamplesNew, _mm_set1_ps(0.0f), _CMP_GE_OQ));
+				currentSamplesNew = _mm_min_ps(_mm_max_ps(currentSamplesNew, _mm_set1_ps(static_cast<float>(std::numeric_limits<int16_t>::min()))),
+					_mm_set1_ps(static_cast<float>(std::numeric_limits<int16_t>::max())));
 
-				storeValues(_mm_cvtps_epi32(currentSamplesNew), dataOut);
+				_mm_storel_epi64(reinterpret_cast<AvxInt*>(dataOut), _mm_packs_epi32(_mm_cvtps_epi32(currentSamplesNew), _mm_setzero_si128()));
 			}
 
-			/// @brief Combine a register worth of elements from decodedData and store the result in upSampledVector. This version uses AVX instructions.
+			/// @brief Combine a register worth of elements from decodedData and store the result in upSampledVector. This version uses AVX or SSE2 instructions.
 			/// @param upSampledVector Pointer to the array of int32_t values.
 			/// @param decodedData Pointer to the array of int16_t values.
 			inline static void combineSamples(int32_t* upSampledVector, const int16_t* decodedData) {
-				auto newValues{ _mm_cvtps_epi32(_mm_add_ps(gatherValues(upSampledVector), gatherValues(decodedData))) };
-				storeValues(newValues, upSampledVector);
+				_mm_storeu_si128(reinterpret_cast<AvxInt*>(upSampledVector),
+					_mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const AvxInt*>(upSampledVector)), widenValues(decodedData)));
 			}
 		};
 
 #else
 
-		/// @brief A class for audio mixing operations using AVX instructions.
+		/// @brief A class for audio mixing operations using scalar instructions.
 		class AudioMixer {
 		  public:
 			/// @brief The number of 32-bit values per CPU register.
 			static constexpr int32_t byteBlocksPerRegister{ 2 };
 
-			/// @brief Collect a single register worth of data from dataIn, apply gain and increment, and store the result in dataOut. This version uses x64 instructions.
+			/// @brief Collect a single register worth of data from dataIn, apply gain and increment, and store the result in dataOut. This version uses scalar instructions.
 			/// @param dataIn Pointer to the input array of int32_t values.
 			/// @param dataOut Pointer to the output array of int16_t values.
 			/// @param currentGain The gain to be applied to the elements.
@@ -313,7 +189,7 @@ namespace DiscordCoreAPI {
 				}
 			}
 
-			/// @brief Combine a register worth of elements from decodedData and store the result in upSampledVector. This version uses x64 instructions.
+			/// @brief Combine a register worth of elements from decodedData and store the result in upSampledVector. This version uses scalar instructions.
 			/// @param upSampledVector Pointer to the array of int32_t values.
 			/// @param decodedData Pointer to the array of int16_t values.
 			inline static void combineSamples(int32_t* upSampledVector, const int16_t* decodedData) {
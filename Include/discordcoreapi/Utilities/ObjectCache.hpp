@@ -32,10 +32,62 @@
 
 #include <discordcoreapi/Utilities/Base.hpp>
 #include <discordcoreapi/Utilities/Etf.hpp>
-
 namespace DiscordCoreAPI {
 
+	/// @brief Limits for a single ObjectCache - zero disables the respective limit.
+	struct ObjectCacheLimits {
+		uint64_t maxEntries{};///< The most objects to hold before the least recently used ones are evicted.
+		uint32_t ttlInSeconds{};///< How long an object is served for after being inserted.
+	};
+
+	/// @brief Counters for a single ObjectCache.
+	struct ObjectCacheStats {
+		uint64_t expirations{};///< Objects dropped for outliving the cache's time-to-live.
+		uint64_t evictions{};///< Objects dropped to make room.
+		uint64_t misses{};///< Lookups that found no fresh object.
+		uint64_t hits{};///< Lookups that found a fresh object.
+		uint64_t size{};///< Objects currently held.
+	};
+
+	/// @brief The memory budget shared by every bounded ObjectCache.
+	/// @details Usage is estimated from the size of each cached object and its bookkeeping - memory that an object owns on the heap is not counted.
+	class ObjectCacheBudget {
+	  public:
+		template<typename ValueType> friend class ObjectCache;
+
+		/// @brief Sets the budget - zero disables it. This must be set before the caches are given their limits.
+		/// @param budgetBytesNew The budget, in bytes.
+		inline static void setBudget(uint64_t budgetBytesNew) {
+			budgetBytes.store(budgetBytesNew, std::memory_order_release);
+		}
+
+		/// @brief Get the estimated number of bytes held by the bounded caches.
+		/// @return The number of bytes.
+		inline static uint64_t getUsedBytes() {
+			return usedBytes.load(std::memory_order_acquire);
+		}
+
+		/// @brief Get the budget.
+		/// @return The budget, in bytes.
+		inline static uint64_t getBudget() {
+			return budgetBytes.load(std::memory_order_acquire);
+		}
+
+	  protected:
+		inline static std::atomic<uint64_t> budgetBytes{};
+		inline static std::atomic<uint64_t> usedBytes{};
+
+		inline static bool areWeOverBudget() {
+			uint64_t budgetBytesNew{ budgetBytes.load(std::memory_order_acquire) };
+			return budgetBytesNew && usedBytes.load(std::memory_order_acquire) > budgetBytesNew;
+		}
+	};
+
 	/// @brief A template class representing an object cache.
+	/// @details The cache is partitioned by key hash into independently locked shards, so that writers to one shard never block readers or writers of another
+	/// - and each shard grows on its own. Once given limits, each shard also keeps a CLOCK ring of its objects: lookups set an object's reference bit, and
+	/// inserting into a full shard sweeps the ring, evicting the first object that is expired or hasn't been referenced since the last sweep. With a
+	/// time-to-live set, every insert also checks the next few slots of the ring for expiry, so that expired objects are reclaimed even when nothing fills it.
 	/// @tparam ValueType The type of data stored in the cache.
 	template<typename ValueType> class ObjectCache {
 	  public:
@@ -43,18 +95,80 @@ namespace DiscordCoreAPI {
 		using reference		  = mapped_type&;
 		using const_reference = const mapped_type&;
 		using pointer		  = mapped_type*;
+		using key_type		  = std::conditional_t<HasId<mapped_type>, Snowflake, TwoIdKey>;
+
+		static constexpr uint64_t shardBits{ 4 };///< The number of hash bits used to select a shard.
+		static constexpr uint64_t shardCount{ 1ull << shardBits };///< The number of independently locked shards.
+		static constexpr uint64_t expirySweepSlots{ 4 };///< The number of CLOCK slots checked for expiry on each insert.
+
+		/// @brief An iterator that walks every shard of the cache in turn.
+		class iterator {
+		  public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type		= mapped_type;
+			using reference			= mapped_type&;
+			using pointer			= mapped_type*;
+			using set_iterator		= typename UnorderedSet<mapped_type>::const_iterator;
+
+			inline iterator() noexcept = default;
+
+			inline iterator(const ObjectCache* cacheNew, uint64_t shardIndexNew) : cache{ cacheNew }, shardIndex{ shardIndexNew } {
+				skipEmptyShards();
+			}
+
+			inline iterator& operator++() {
+				++currentIter;
+				if (currentIter == cache->shards[shardIndex].cacheMap.end()) {
+					++shardIndex;
+					skipEmptyShards();
+				}
+				return *this;
+			}
+
+			inline bool operator==(const iterator&) const {
+				return !cache || shardIndex >= shardCount;
+			}
+
+			inline pointer operator->() const {
+				return currentIter.operator->();
+			}
+
+			inline reference operator*() const {
+				return currentIter.operator*();
+			}
+
+		  protected:
+			const ObjectCache* cache{};
+			set_iterator currentIter{};
+			uint64_t shardIndex{};
+
+			inline void skipEmptyShards() {
+				for (; shardIndex < shardCount; ++shardIndex) {
+					currentIter = cache->shards[shardIndex].cacheMap.begin();
+					if (!(currentIter == cache->shards[shardIndex].cacheMap.end())) {
+						return;
+					}
+				}
+			}
+		};
 
 		/// @brief Default constructor for the ObjectCache class.
-		inline ObjectCache() : cacheMap{} {};
+		inline ObjectCache() : shards{} {};
 
 		/// @brief Move assignment operator for the ObjectCache class.
 		/// @param other Another ObjectCache instance to be moved.
 		/// @return Reference to the current ObjectCache instance.
 		inline ObjectCache& operator=(ObjectCache&& other) {
 			if (this != &other) {
-				std::unique_lock lock01{ other.cacheMutex };
-				std::unique_lock lock02{ cacheMutex };
-				std::swap(cacheMap, other.cacheMap);
+				for (uint64_t x = 0; x < shardCount; ++x) {
+					std::unique_lock lock01{ other.shards[x].cacheMutex };
+					std::unique_lock lock02{ shards[x].cacheMutex };
+					std::swap(shards[x].cacheMap, other.shards[x].cacheMap);
+					std::swap(shards[x].clockIndices, other.shards[x].clockIndices);
+					std::swap(shards[x].clockRing, other.shards[x].clockRing);
+				}
+				std::swap(limits, other.limits);
+				std::swap(doWeTrack, other.doWeTrack);
 			}
 			return *this;
 		}
@@ -67,22 +181,109 @@ namespace DiscordCoreAPI {
 
 		// Copy assignment and copy constructor are deleted.
 
+		/// @brief Sets the cache's capacity and time-to-live, and starts tracking its objects for eviction if either - or the shared budget - is set.
+		/// @details This should be called before the cache is first used.
+		/// @param limitsNew The new limits.
+		inline void setLimits(const ObjectCacheLimits& limitsNew) {
+			limits	  = limitsNew;
+			doWeTrack = limits.maxEntries || limits.ttlInSeconds || ObjectCacheBudget::getBudget();
+		}
+
+		/// @brief Get the cache's counters.
+		/// @return An ObjectCacheStats structure.
+		inline ObjectCacheStats getStats() const {
+			ObjectCacheStats stats{};
+			for (auto& value: shards) {
+				stats.expirations += value.expirations.load(std::memory_order_relaxed);
+				stats.evictions += value.evictions.load(std::memory_order_relaxed);
+				stats.misses += value.misses.load(std::memory_order_relaxed);
+				stats.hits += value.hits.load(std::memory_order_relaxed);
+				stats.size += value.cacheMap.size();
+			}
+			return stats;
+		}
+
 		/// @brief Add an object to the cache.
 		/// @tparam mapped_type_new The type of the object to be added.
 		/// @param object The object to be added to the cache.
 		/// @return An iterator pointing to the newly added object in the cache.
 		template<typename mapped_type_new> inline UnorderedSet<mapped_type>::iterator emplace(mapped_type_new&& object) {
-			std::unique_lock lock(cacheMutex);
-			return cacheMap.emplace(std::forward<mapped_type_new>(object));
+			CacheShard& shard{ getShard(object) };
+			std::unique_lock lock(shard.cacheMutex);
+			return emplaceInternal(shard, std::forward<mapped_type_new>(object));
+		}
+
+		/// @brief Add a range of objects to the cache, taking each shard's lock only once and pre-sizing each shard for its share of the range.
+		/// @details Objects without a valid id are skipped, and an object that fails to insert is reported without abandoning the rest of the range.
+		/// @tparam IteratorType The type of the iterators delimiting the range - pass move iterators to move the objects in.
+		/// @tparam ProjectionType A callable that maps each element of the range to a reference to the object to be added.
+		/// @param first The beginning of the range.
+		/// @param last The end of the range.
+		/// @param projection The projection to apply to each element.
+		template<typename IteratorType, typename ProjectionType = std::identity>
+		inline void insertRange(IteratorType first, IteratorType last, ProjectionType projection = {}) {
+			using projected_type = decltype(projection(*first));
+			static_assert(std::is_reference_v<projected_type>, "Sorry, but the projection must return a reference into the range.");
+			std::array<Jsonifier::Vector<std::remove_reference_t<projected_type>*>, shardCount> shardObjects{};
+			for (; first != last; ++first) {
+				projected_type object{ projection(*first) };
+				if (!isKeyValid(getKey(object))) {
+					MessagePrinter::printError<PrintMessageType::General>("ObjectCache::insertRange() Error: Sorry, but there was no id set for that object.");
+					continue;
+				}
+				shardObjects[getShardIndex(object)].emplace_back(std::addressof(object));
+			}
+			for (uint64_t x = 0; x < shardCount; ++x) {
+				if (shardObjects[x].size() == 0) {
+					continue;
+				}
+				std::unique_lock lock(shards[x].cacheMutex);
+				shards[x].cacheMap.reserve(shards[x].cacheMap.size() + shardObjects[x].size());
+				for (auto& value: shardObjects[x]) {
+					try {
+						emplaceInternal(shards[x], static_cast<projected_type>(*value));
+					} catch (...) {
+						MessagePrinter::printError<PrintMessageType::General>("ObjectCache::insertRange()");
+					}
+				}
+			}
+		}
+
+		/// @brief Copy an object out of the cache using a key - nothing is inserted if the key is missing.
+		/// @details Changes made to the copy are not written back - use update() for that.
+		/// @tparam mapped_type_new The type of the key used for access.
+		/// @param key The key used for accessing the object in the cache.
+		/// @return A copy of the object associated with the provided key.
+		/// @throws DCAException if no fresh object by that key is in the cache.
+		template<typename mapped_type_new> inline mapped_type at(mapped_type_new&& key) {
+			mapped_type object{};
+			if (!visit(key, [&](const_reference value) {
+					object = value;
+				})) {
+				throw DCAException{ "ObjectCache::at() Error: Sorry, but there is no object by that key in the cache." };
+			}
+			return object;
 		}
 
-		/// @brief Access an object in the cache using a key.
+		/// @brief Deleted, since the cache hands out copies rather than references - so an assignment through it would only ever write to a temporary.
+		template<typename mapped_type_new> mapped_type operator[](mapped_type_new&& key) = delete;
+
+		/// @brief Modify an object in the cache in place, under its shard's unique lock.
+		/// @details Only an object that is already in the cache is touched - nothing is inserted, and the function must not change the object's key.
 		/// @tparam mapped_type_new The type of the key used for access.
+		/// @tparam FunctionType A callable taking a reference to the cached object.
 		/// @param key The key used for accessing the object in the cache.
-		/// @return Reference to the object associated with the provided key.
-		template<typename mapped_type_new> inline reference operator[](mapped_type_new&& key) {
-			std::shared_lock lock(cacheMutex);
-			return cacheMap[std::forward<mapped_type_new>(key)];
+		/// @param function The function to invoke on the cached object.
+		/// @return `true` if the object was found and updated, `false` otherwise.
+		template<typename mapped_type_new, typename FunctionType> inline bool update(mapped_type_new&& key, FunctionType&& function) {
+			CacheShard& shard{ getShard(key) };
+			std::unique_lock lock(shard.cacheMutex);
+			auto iter = shard.cacheMap.find(key);
+			if (iter == shard.cacheMap.end()) {
+				return false;
+			}
+			std::forward<FunctionType>(function)(*iter);
+			return true;
 		}
 
 		/// @brief Check if the cache contains an object with a given key.
@@ -90,53 +291,283 @@ namespace DiscordCoreAPI {
 		/// @param key The key to check for existence in the cache.
 		/// @return `true` if the cache contains the key, `false` otherwise.
 		template<typename mapped_type_new> inline bool contains(mapped_type_new&& key) {
-			std::shared_lock lock(cacheMutex);
-			return cacheMap.contains(std::forward<mapped_type_new>(key));
+			CacheShard& shard{ getShard(key) };
+			std::shared_lock lock(shard.cacheMutex);
+			bool found{ shard.cacheMap.contains(key) && (!doWeTrack || touch(shard, key)) };
+			(found ? shard.hits : shard.misses).fetch_add(1, std::memory_order_relaxed);
+			return found;
+		}
+
+		/// @brief Read an object in the cache in place, without copying it out.
+		/// @details The function is invoked under the shard's shared lock, so it should only read what it needs and return - it must not write to this cache.
+		/// @tparam mapped_type_new The type of the key used for access.
+		/// @tparam FunctionType A callable taking a const reference to the cached object.
+		/// @param key The key used for accessing the object in the cache.
+		/// @param function The function to invoke on the cached object.
+		/// @return `true` if the object was found and visited, `false` otherwise.
+		template<typename mapped_type_new, typename FunctionType> inline bool visit(mapped_type_new&& key, FunctionType&& function) {
+			CacheShard& shard{ getShard(key) };
+			std::shared_lock lock(shard.cacheMutex);
+			auto iter = shard.cacheMap.find(key);
+			if (iter == shard.cacheMap.end() || (doWeTrack && !touch(shard, key))) {
+				shard.misses.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			shard.hits.fetch_add(1, std::memory_order_relaxed);
+			std::forward<FunctionType>(function)(static_cast<const_reference>(*iter));
+			return true;
+		}
+
+		/// @brief Read every fresh object in the cache in place, one shard at a time under that shard's shared lock.
+		/// @details Unlike visit, this does not mark the objects as referenced, so a full walk leaves the eviction order alone.
+		/// @tparam FunctionType A callable taking a const reference to a cached object.
+		/// @param function The function to invoke on each object.
+		template<typename FunctionType> inline void visitAll(FunctionType&& function) {
+			uint32_t currentTime{ getCurrentTime() };
+			for (auto& shard: shards) {
+				std::shared_lock lock(shard.cacheMutex);
+				for (auto& value: shard.cacheMap) {
+					if (doWeTrack) {
+						auto iter = shard.clockIndices.find(KeyHasher{}(value));
+						if (iter != shard.clockIndices.end() && isExpired(shard.clockRing[iter->second], currentTime)) {
+							continue;
+						}
+					}
+					function(static_cast<const_reference>(value));
+				}
+			}
 		}
 
 		/// @brief Remove an object from the cache using a key.
 		/// @tparam mapped_type_new The type of the key used for removal.
 		/// @param key The key used to remove the object from the cache.
 		template<typename mapped_type_new> inline auto erase(mapped_type_new&& key) {
-			std::unique_lock lock(cacheMutex);
-			return cacheMap.erase(std::forward<mapped_type_new>(key));
+			CacheShard& shard{ getShard(key) };
+			std::unique_lock lock(shard.cacheMutex);
+			if (doWeTrack) {
+				if (auto iter = shard.clockIndices.find(KeyHasher{}(key)); iter != shard.clockIndices.end()) {
+					untrack(shard, iter->second);
+				}
+			}
+			return shard.cacheMap.erase(std::forward<mapped_type_new>(key));
 		}
 
 		/// @brief Get the number of objects currently in the cache.
 		/// @return The number of objects in the cache.
 		inline uint64_t size() const {
-			return cacheMap.size();
+			uint64_t sizeNew{};
+			for (auto& value: shards) {
+				sizeNew += value.cacheMap.size();
+			}
+			return sizeNew;
 		}
 
 		/// @brief Get the current capacity of the cache.
 		/// @return The capacity of the cache.
 		inline uint64_t capacity() const {
-			return cacheMap.capacity();
+			uint64_t capacityNew{};
+			for (auto& value: shards) {
+				capacityNew += value.cacheMap.capacity();
+			}
+			return capacityNew;
 		}
 
+		/// @brief Reserve room for a total number of objects, spread evenly across the shards.
+		/// @param newCapacity The total number of objects to make room for.
 		inline void reserve(uint64_t newCapacity) {
-			std::unique_lock lock(cacheMutex);
-			cacheMap.reserve(newCapacity);
+			uint64_t shardCapacity{ (newCapacity + shardCount - 1) / shardCount };
+			for (auto& value: shards) {
+				if (value.cacheMap.capacity() < shardCapacity) {
+					std::unique_lock lock(value.cacheMutex);
+					value.cacheMap.reserve(shardCapacity);
+				}
+			}
 		}
 
 		/// @brief Get an iterator to the beginning of the cache.
 		/// @return An iterator to the beginning of the cache.
-		inline auto begin() const {
-			return cacheMap.begin();
+		inline iterator begin() const {
+			return iterator{ this, 0 };
 		}
 
 		/// @brief Get an iterator to the end of the cache.
 		/// @return An iterator to the end of the cache.
-		inline auto end() const {
-			return cacheMap.end();
+		inline iterator end() const {
+			return {};
 		}
 
 		/// @brief Destructor for the ObjectCache class.
 		inline ~ObjectCache(){};
 
 	  protected:
-		UnorderedSet<mapped_type> cacheMap{};///< The underlying container for storing objects.
-		std::shared_mutex cacheMutex{};///< Mutex for ensuring thread-safe access to the cache.
+		/// @brief An object's entry in its shard's CLOCK ring.
+		struct ClockSlot {
+			uint32_t insertedAt{};///< When the object was last inserted, in seconds.
+			uint8_t referenced{};///< Set by lookups, cleared by the sweep.
+			uint64_t hash{};///< The hash of the object's key.
+			key_type key{};///< The object's key.
+		};
+
+		/// @brief A single, independently locked partition of the cache.
+		struct alignas(64) CacheShard {
+			UnorderedMap<uint64_t, uint32_t> clockIndices{};///< Key hash to position in the CLOCK ring.
+			std::atomic<uint64_t> expirations{};///< Objects dropped for outliving the time-to-live.
+			UnorderedSet<mapped_type> cacheMap{};///< The underlying container for storing objects.
+			Jsonifier::Vector<ClockSlot> clockRing{};///< The tracked objects, in sweep order.
+			std::atomic<uint64_t> evictions{};///< Objects dropped to make room.
+			std::shared_mutex cacheMutex{};///< Mutex for ensuring thread-safe access to this shard.
+			std::atomic<uint64_t> misses{};///< Lookups that found no fresh object.
+			std::atomic<uint64_t> hits{};///< Lookups that found a fresh object.
+			uint64_t clockHand{};///< The sweep's current position in the CLOCK ring.
+			uint64_t expiryHand{};///< The expiry sweep's current position in the CLOCK ring.
+		};
+
+		static constexpr uint64_t bytesPerEntry{ sizeof(mapped_type) + sizeof(ClockSlot) + sizeof(Pair<uint64_t, uint32_t>) };
+
+		std::array<CacheShard, shardCount> shards{};///< The shards of the cache.
+		ObjectCacheLimits limits{};///< The cache's capacity and time-to-live.
+		bool doWeTrack{};///< Whether objects are tracked for eviction.
+
+		/// @brief Inserts an object into a shard whose lock is held, making room for it first if the shard is full or the budget is spent.
+		template<typename mapped_type_new> inline UnorderedSet<mapped_type>::iterator emplaceInternal(CacheShard& shard, mapped_type_new&& object) {
+			if (!doWeTrack) {
+				return shard.cacheMap.emplace(std::forward<mapped_type_new>(object));
+			}
+			uint64_t hash{ KeyHasher{}(object) };
+			key_type key{ getKey(object) };
+			auto iter = shard.clockIndices.find(hash);
+			if (iter != shard.clockIndices.end()) {
+				ClockSlot& slot{ shard.clockRing[iter->second] };
+				slot.insertedAt = getCurrentTime();
+				slot.referenced = 1;
+				return shard.cacheMap.emplace(std::forward<mapped_type_new>(object));
+			}
+			if (limits.ttlInSeconds) {
+				sweepExpired(shard);
+			}
+			uint64_t shardCapacity{ (limits.maxEntries + shardCount - 1) / shardCount };
+			while (shardCapacity && shard.clockRing.size() >= shardCapacity && evictOne(shard)) {
+			}
+			if (ObjectCacheBudget::areWeOverBudget()) {
+				evictOne(shard);
+			}
+			auto newIter = shard.cacheMap.emplace(std::forward<mapped_type_new>(object));
+			ObjectCacheBudget::usedBytes.fetch_add(bytesPerEntry, std::memory_order_acq_rel);
+			shard.clockIndices.emplace(hash, static_cast<uint32_t>(shard.clockRing.size()));
+			shard.clockRing.emplace_back(ClockSlot{ getCurrentTime(), 0, hash, key });
+			return newIter;
+		}
+
+		/// @brief Marks a tracked object as referenced, under the shard's shared lock.
+		/// @return `false` if the object has outlived the time-to-live.
+		template<typename KeyType> inline bool touch(CacheShard& shard, const KeyType& key) {
+			auto iter = shard.clockIndices.find(KeyHasher{}(key));
+			if (iter == shard.clockIndices.end()) {
+				return true;
+			}
+			ClockSlot& slot{ shard.clockRing[iter->second] };
+			if (isExpired(slot, getCurrentTime())) {
+				return false;
+			}
+			std::atomic_ref<uint8_t>{ slot.referenced }.store(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		/// @brief Advances the shard's CLOCK hand until it drops an expired or unreferenced object.
+		/// @return `false` if the shard holds no tracked objects.
+		inline bool evictOne(CacheShard& shard) {
+			uint32_t currentTime{ getCurrentTime() };
+			for (uint64_t x = 0; x < shard.clockRing.size() * 2; ++x) {
+				if (shard.clockHand >= shard.clockRing.size()) {
+					shard.clockHand = 0;
+				}
+				ClockSlot& slot{ shard.clockRing[shard.clockHand] };
+				bool isItExpired{ isExpired(slot, currentTime) };
+				if (!isItExpired && slot.referenced) {
+					slot.referenced = 0;
+					++shard.clockHand;
+					continue;
+				}
+				(isItExpired ? shard.expirations : shard.evictions).fetch_add(1, std::memory_order_relaxed);
+				key_type key{ slot.key };
+				untrack(shard, shard.clockHand);
+				shard.cacheMap.erase(key);
+				return true;
+			}
+			return false;
+		}
+
+		/// @brief Checks the next expirySweepSlots slots of the shard's CLOCK ring, dropping any expired objects - leaving the reference bits alone.
+		inline void sweepExpired(CacheShard& shard) {
+			uint32_t currentTime{ getCurrentTime() };
+			for (uint64_t x = 0; x < expirySweepSlots && shard.clockRing.size() > 0; ++x) {
+				if (shard.expiryHand >= shard.clockRing.size()) {
+					shard.expiryHand = 0;
+				}
+				ClockSlot& slot{ shard.clockRing[shard.expiryHand] };
+				if (!isExpired(slot, currentTime)) {
+					++shard.expiryHand;
+					continue;
+				}
+				shard.expirations.fetch_add(1, std::memory_order_relaxed);
+				key_type key{ slot.key };
+				// The ring's last slot is moved into this one, so the hand stays put to check it next.
+				untrack(shard, shard.expiryHand);
+				shard.cacheMap.erase(key);
+			}
+		}
+
+		/// @brief Drops an object's slot from the CLOCK ring, by moving the last slot into its place.
+		inline void untrack(CacheShard& shard, uint64_t index) {
+			uint64_t lastIndex{ shard.clockRing.size() - 1 };
+			shard.clockIndices.erase(shard.clockRing[index].hash);
+			if (index != lastIndex) {
+				shard.clockRing[index]						   = shard.clockRing[lastIndex];
+				shard.clockIndices[shard.clockRing[index].hash] = static_cast<uint32_t>(index);
+			}
+			shard.clockRing.resize(lastIndex);
+			ObjectCacheBudget::usedBytes.fetch_sub(bytesPerEntry, std::memory_order_acq_rel);
+		}
+
+		inline bool isExpired(const ClockSlot& slot, uint32_t currentTime) const {
+			return limits.ttlInSeconds && currentTime - slot.insertedAt >= limits.ttlInSeconds;
+		}
+
+		inline static uint32_t getCurrentTime() {
+			return static_cast<uint32_t>(std::chrono::duration_cast<Seconds>(HRClock::now().time_since_epoch()).count());
+		}
+
+		/// @brief Extracts the key of an object, straight from whatever type it was passed in as - without first converting it to mapped_type.
+		template<typename ObjectType> inline static key_type getKey(const ObjectType& object) {
+			if constexpr (HasId<mapped_type>) {
+				return object.id;
+			} else {
+				return TwoIdKey{ object };
+			}
+		}
+
+		inline static bool isKeyValid(const key_type& key) {
+			if constexpr (HasId<mapped_type>) {
+				return key != 0;
+			} else {
+				return key.idOne != 0 && key.idTwo != 0;
+			}
+		}
+
+		/// @brief Selects the shard for a key or object, from the top bits of its hash.
+		/// @param key The key or object to select a shard for.
+		/// @return The shard that owns the key.
+		template<typename KeyType> inline CacheShard& getShard(const KeyType& key) {
+			return shards[getShardIndex(key)];
+		}
+
+		/// @brief Computes the index of the shard for a key or object.
+		/// @param key The key or object to select a shard for.
+		/// @return The index of the shard that owns the key.
+		template<typename KeyType> inline static uint64_t getShardIndex(const KeyType& key) {
+			KeyHasher hasher{};
+			return hasher(key) >> (64 - shardBits);
+		}
 	};
 
 
@@ -0,0 +1,128 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// RequestCoalescer.hpp - Header file for the RequestCoalescer class.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file RequestCoalescer.hpp
+
+#pragma once
+
+#include <discordcoreapi/Utilities/HttpsClient.hpp>
+
+#include <future>
+
+namespace DiscordCoreAPI {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief Collapses concurrent fetches of the same key into a single in-flight fetch, whose result - or exception - every caller then shares.
+	/// @details Optionally remembers 404s for a while, so that repeated lookups of something that doesn't exist don't spend rate-limit budget either.
+	/// @tparam KeyType The type of the key identifying a fetch.
+	/// @tparam ValueType The type of the fetched value.
+	template<typename KeyType, typename ValueType> class RequestCoalescer {
+	  public:
+		static constexpr uint64_t maxNegativeEntries{ 65536 };///< The number of 404s remembered before the negative cache is cleared.
+
+		inline RequestCoalescer() = default;
+
+		/// @brief Sets how long a 404 is remembered for - zero disables the negative cache.
+		/// @param negativeTtlNew The new time-to-live.
+		inline void setNegativeTtl(Milliseconds negativeTtlNew) {
+			negativeTtl.store(negativeTtlNew, std::memory_order_release);
+		}
+
+		/// @brief Runs a fetch for a key, unless one is already in flight - in which case its result is waited on instead.
+		/// @tparam FunctionType A callable returning the fetched value.
+		/// @param key The key identifying the fetch.
+		/// @param function The fetch to run.
+		/// @return The fetched value.
+		template<typename FunctionType> inline ValueType run(const KeyType& key, FunctionType&& function) {
+			std::unique_lock lock{ accessMutex };
+			if (auto iter = negativeEntries.find(key); iter != negativeEntries.end()) {
+				if (std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) < iter->second.expiry) {
+					std::exception_ptr exception{ iter->second.exception };
+					lock.unlock();
+					std::rethrow_exception(exception);
+				}
+				negativeEntries.erase(key);
+			}
+			if (auto iter = inFlight.find(key); iter != inFlight.end()) {
+				std::shared_future<ValueType> result{ iter->second };
+				lock.unlock();
+				DiscordCoreInternal::BlockingRegion blockingRegion{};
+				return result.get();
+			}
+			std::promise<ValueType> promise{};
+			inFlight.emplace(key, promise.get_future().share());
+			lock.unlock();
+			try {
+				ValueType result{ std::forward<FunctionType>(function)() };
+				lock.lock();
+				inFlight.erase(key);
+				lock.unlock();
+				promise.set_value(result);
+				return result;
+			} catch (const DiscordCoreInternal::HttpsError& error) {
+				finishWithException(key, promise, std::current_exception(), error.errorCode == 404);
+				throw;
+			} catch (...) {
+				finishWithException(key, promise, std::current_exception(), false);
+				throw;
+			}
+		}
+
+	  protected:
+		/// @brief A remembered 404.
+		struct NegativeEntry {
+			std::exception_ptr exception{};
+			Milliseconds expiry{};
+		};
+
+		UnorderedMap<KeyType, std::shared_future<ValueType>> inFlight{};
+		UnorderedMap<KeyType, NegativeEntry> negativeEntries{};
+		std::atomic<Milliseconds> negativeTtl{ Milliseconds{ 0 } };
+		std::mutex accessMutex{};
+
+		inline void finishWithException(const KeyType& key, std::promise<ValueType>& promise, std::exception_ptr exception, bool wasItNotFound) {
+			std::unique_lock lock{ accessMutex };
+			inFlight.erase(key);
+			Milliseconds negativeTtlNew{ negativeTtl.load(std::memory_order_acquire) };
+			if (wasItNotFound && negativeTtlNew.count() > 0) {
+				if (negativeEntries.size() >= maxNegativeEntries) {
+					negativeEntries.clear();
+				}
+				negativeEntries.emplace(key, NegativeEntry{ exception, std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) + negativeTtlNew });
+			}
+			lock.unlock();
+			promise.set_exception(exception);
+		}
+	};
+
+	/**@}*/
+}
@@ -74,6 +74,10 @@
 	#include <netdb.h>
 	#include <fcntl.h>
 	#include <poll.h>
+	#if defined(__linux__)
+		#include <sys/eventfd.h>
+		#include <sys/epoll.h>
+	#endif
 using SOCKET = int32_t;
 #endif
 
@@ -145,11 +149,6 @@ namespace DiscordCoreAPI {
 		};
 #endif
 
-		struct PollFDWrapper {
-			Jsonifier::Vector<uint64_t> indices{};
-			Jsonifier::Vector<pollfd> polls{};
-		};
-
 		struct SSL_CTXWrapper {
 			struct SSL_CTXDeleter {
 				inline void operator()(SSL_CTX* other) {
@@ -302,6 +301,7 @@ namespace DiscordCoreAPI {
 
 		template<typename ValueType> class SSLDataInterface {
 		  public:
+			template<typename ValueType2> friend class TCPConnectionReactor;
 			template<typename ValueType2> friend class TCPConnection;
 			friend class HttpsClient;
 
@@ -640,101 +640,224 @@ namespace DiscordCoreAPI {
 				return true;
 			}
 
-			template<typename ValueType2> inline static UnorderedMap<uint64_t, ValueType2*> processIO(UnorderedMap<uint64_t, ValueType2*>& shardMap) {
-				UnorderedMap<uint64_t, ValueType2*> returnData{};
-				PollFDWrapper readWriteSet{};
-				for (auto& [key, value]: shardMap) {
-					if (value->areWeStillConnected()) {
-						pollfd fdSet{};
-						fdSet.fd = static_cast<SOCKET>(value->socket);
-						if ((value->outputBuffer.getUsedSpace() > 0 || value->writeWantWrite || value->readWantWrite) && !value->readWantRead && !value->writeWantRead) {
-							fdSet.events = POLLIN | POLLOUT;
-						} else if (!value->writeWantWrite && !value->readWantWrite) {
-							fdSet.events = POLLIN;
-						}
-						readWriteSet.indices.emplace_back(key);
-						readWriteSet.polls.emplace_back(fdSet);
-					} else {
-						returnData.emplace(key, value);
-					}
+			inline void disconnect() {
+				currentStatus = ConnectionStatus::CONNECTION_Error;
+				static_cast<ValueType*>(this)->reset();
+				socket = INVALID_SOCKET;
+				ssl	   = nullptr;
+			}
+
+			inline virtual ~TCPConnection() = default;
+
+		  protected:
+			inline TCPConnection() = default;
+		};
+
+		/// @brief A persistent readiness reactor for a set of TCPConnections.
+		/// Connections are registered once, and are serviced on edge-triggered readiness (epoll on Linux, poll elsewhere).
+		/// @tparam ValueType The type of connection being serviced.
+		template<typename ValueType> class TCPConnectionReactor {
+		  public:
+			inline TCPConnectionReactor() {
+#if defined(__linux__)
+				if (epollDescriptor = epoll_create1(EPOLL_CLOEXEC); epollDescriptor == SOCKET_ERROR) {
+					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnectionReactor::epoll_create1()"));
+					return;
 				}
+				if (wakeDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC); wakeDescriptor == SOCKET_ERROR) {
+					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnectionReactor::eventfd()"));
+					return;
+				}
+				epoll_event event{};
+				event.events   = EPOLLIN;
+				event.data.u64 = wakeKey;
+				if (epoll_ctl(epollDescriptor, EPOLL_CTL_ADD, wakeDescriptor, &event) == SOCKET_ERROR) {
+					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnectionReactor::epoll_ctl()"));
+				}
+#endif
+			}
 
-				if (readWriteSet.polls.size() == 0) {
-					return returnData;
+			/// @brief Registers a connection with the reactor, if it is not already registered.
+			/// @param key The key to report the connection under.
+			/// @param connection The connection to service.
+			inline void registerConnection(uint64_t key, ValueType* connection) {
+				if (connections.contains(key)) {
+					return;
 				}
-				if (auto returnDataNew = poll(readWriteSet.polls.data(), static_cast<u_long>(readWriteSet.polls.size()), 1); returnDataNew == SOCKET_ERROR) {
-					bool didWeFindTheSocket{};
-					for (uint64_t x = 0; x < readWriteSet.polls.size(); ++x) {
-						if (readWriteSet.polls.at(x).revents & POLLERR || readWriteSet.polls.at(x).revents & POLLHUP || readWriteSet.polls.at(x).revents & POLLNVAL) {
-							shardMap.at(readWriteSet.indices.at(x))->currentStatus = ConnectionStatus::SOCKET_Error;
-							returnData.emplace(readWriteSet.indices.at(x), shardMap.at(readWriteSet.indices.at(x)));
-							readWriteSet.indices.erase(readWriteSet.indices.begin() + x);
-							readWriteSet.polls.erase(readWriteSet.polls.begin() + x);
-							didWeFindTheSocket = true;
-						}
-					}
-					if (!didWeFindTheSocket) {
-						for (uint64_t x = 0; x < readWriteSet.polls.size(); ++x) {
-							shardMap.at(readWriteSet.indices.at(x))->currentStatus = ConnectionStatus::SOCKET_Error;
-							returnData.emplace(readWriteSet.indices.at(x), shardMap.at(readWriteSet.indices.at(x)));
-						}
-						return returnData;
+#if defined(__linux__)
+				epoll_event event{};
+				event.events   = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+				event.data.u64 = key;
+				SOCKET socket  = connection->socket;
+				if (epoll_ctl(epollDescriptor, EPOLL_CTL_ADD, socket, &event) == SOCKET_ERROR &&
+					(errno != EEXIST || epoll_ctl(epollDescriptor, EPOLL_CTL_MOD, socket, &event) == SOCKET_ERROR)) {
+					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnectionReactor::registerConnection()"));
+					return;
+				}
+#endif
+				connections.emplace(key, ConnectionData{ connection, true, true });
+			}
+
+			/// @brief Removes a connection from the reactor.
+			/// @param key The key that the connection was registered under.
+			inline void removeConnection(uint64_t key) {
+				if (auto iter = connections.find(key); iter != connections.end()) {
+#if defined(__linux__)
+					if (SOCKET socket = iter->second.connection->socket; socket != INVALID_SOCKET) {
+						epoll_ctl(epollDescriptor, EPOLL_CTL_DEL, socket, nullptr);
 					}
+#endif
+					connections.erase(key);
+				}
+			}
 
-				} else if (returnDataNew == 0) {
-					return returnData;
+			/// @brief Wakes a thread that is currently waiting in processIO().
+			inline void wakeUp() {
+#if defined(__linux__)
+				uint64_t value{ 1 };
+				[[maybe_unused]] auto result = write(wakeDescriptor, &value, sizeof(value));
+#endif
+			}
+
+			/// @brief Waits for readiness on the registered connections, for at most waitTime, and services every ready connection.
+			/// @param waitTime The maximum amount of time to wait for readiness.
+			/// @return The keys of the connections that were lost, which have been removed from the reactor.
+			inline const Jsonifier::Vector<uint64_t>& processIO(Milliseconds waitTime) {
+				lostConnections.clear();
+				if (areThereReadsPending) {
+					waitTime = 0ms;
 				}
-				for (uint64_t x = 0; x < readWriteSet.polls.size(); ++x) {
-					if (readWriteSet.polls.at(x).revents & POLLOUT || (POLLIN && shardMap.at(readWriteSet.indices.at(x))->writeWantRead)) {
-						if (!shardMap.at(readWriteSet.indices.at(x))->processWriteData()) {
-							shardMap.at(readWriteSet.indices.at(x))->currentStatus = ConnectionStatus::WRITE_Error;
-							returnData.emplace(readWriteSet.indices.at(x), shardMap.at(readWriteSet.indices.at(x)));
-							continue;
-						}
-					}
-					if (readWriteSet.polls.at(x).revents & POLLIN || (POLLOUT && shardMap.at(readWriteSet.indices.at(x))->readWantWrite)) {
-						if (!shardMap.at(readWriteSet.indices.at(x))->processReadData()) {
-							shardMap.at(readWriteSet.indices.at(x))->currentStatus = ConnectionStatus::READ_Error;
-							returnData.emplace(readWriteSet.indices.at(x), shardMap.at(readWriteSet.indices.at(x)));
-							continue;
-						}
-					}
-					if (readWriteSet.polls.at(x).revents & POLLERR) {
-						shardMap.at(readWriteSet.indices.at(x))->currentStatus = ConnectionStatus::POLLERR_Error;
-						shardMap.at(readWriteSet.indices.at(x))->socket		   = INVALID_SOCKET;
-						shardMap.at(readWriteSet.indices.at(x))->ssl		   = nullptr;
-						returnData.emplace(readWriteSet.indices.at(x), shardMap.at(readWriteSet.indices.at(x)));
+#if defined(__linux__)
+				int32_t eventCount = epoll_wait(epollDescriptor, events.data(), static_cast<int32_t>(events.size()), static_cast<int32_t>(waitTime.count()));
+				if (eventCount == SOCKET_ERROR && errno != EINTR) {
+					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnectionReactor::processIO()"));
+				}
+				for (int32_t x = 0; x < eventCount; ++x) {
+					if (events[x].data.u64 == wakeKey) {
+						uint64_t value{};
+						[[maybe_unused]] auto result = read(wakeDescriptor, &value, sizeof(value));
 						continue;
 					}
-					if (readWriteSet.polls.at(x).revents & POLLNVAL) {
-						shardMap.at(readWriteSet.indices.at(x))->currentStatus = ConnectionStatus::POLLNVAL_Error;
-						shardMap.at(readWriteSet.indices.at(x))->socket		   = INVALID_SOCKET;
-						shardMap.at(readWriteSet.indices.at(x))->ssl		   = nullptr;
-						returnData.emplace(readWriteSet.indices.at(x), shardMap.at(readWriteSet.indices.at(x)));
+					auto iter = connections.find(events[x].data.u64);
+					if (iter == connections.end()) {
 						continue;
 					}
-					if (readWriteSet.polls.at(x).revents & POLLHUP) {
-						shardMap.at(readWriteSet.indices.at(x))->currentStatus = ConnectionStatus::POLLHUP_Error;
-						shardMap.at(readWriteSet.indices.at(x))->socket		   = INVALID_SOCKET;
-						shardMap.at(readWriteSet.indices.at(x))->ssl		   = nullptr;
-						returnData.emplace(readWriteSet.indices.at(x), shardMap.at(readWriteSet.indices.at(x)));
+					if (events[x].events & EPOLLERR) {
+						iter->second.connection->currentStatus = ConnectionStatus::POLLERR_Error;
+					}
+					iter->second.readReady |= static_cast<bool>(events[x].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP));
+					iter->second.writeReady |= static_cast<bool>(events[x].events & EPOLLOUT);
+				}
+#else
+				polls.clear();
+				indices.clear();
+				for (auto& [key, value]: connections) {
+					pollfd fdSet{};
+					fdSet.fd	 = static_cast<SOCKET>(value.connection->socket);
+					fdSet.events = POLLIN;
+					if (value.connection->outputBuffer.getUsedSpace() > 0 || value.connection->writeWantWrite || value.connection->readWantWrite) {
+						fdSet.events |= POLLOUT;
+					}
+					polls.emplace_back(fdSet);
+					indices.emplace_back(key);
+				}
+				if (polls.size() > 0) {
+					if (poll(polls.data(), static_cast<u_long>(polls.size()), static_cast<int32_t>(waitTime.count())) == SOCKET_ERROR) {
+						MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnectionReactor::processIO()"));
+					}
+					for (uint64_t x = 0; x < polls.size(); ++x) {
+						auto& value = connections[indices[x]];
+						if (polls[x].revents & (POLLERR | POLLNVAL)) {
+							value.connection->currentStatus = polls[x].revents & POLLERR ? ConnectionStatus::POLLERR_Error : ConnectionStatus::POLLNVAL_Error;
+						}
+						value.readReady |= static_cast<bool>(polls[x].revents & (POLLIN | POLLHUP));
+						value.writeReady |= static_cast<bool>(polls[x].revents & POLLOUT);
+					}
+				} else {
+					std::this_thread::sleep_for(waitTime);
+				}
+#endif
+				areThereReadsPending = false;
+				for (auto& [key, value]: connections) {
+					if (!serviceConnection(value)) {
+						lostConnections.emplace_back(key);
 						continue;
 					}
+					areThereReadsPending |= value.readReady;
+				}
+				for (auto& value: lostConnections) {
+					removeConnection(value);
 				}
-				return returnData;
+				return lostConnections;
 			}
 
-			inline void disconnect() {
-				currentStatus = ConnectionStatus::CONNECTION_Error;
-				static_cast<ValueType*>(this)->reset();
-				socket = INVALID_SOCKET;
-				ssl	   = nullptr;
+			inline ~TCPConnectionReactor() {
+#if defined(__linux__)
+				if (wakeDescriptor != SOCKET_ERROR) {
+					close(wakeDescriptor);
+				}
+				if (epollDescriptor != SOCKET_ERROR) {
+					close(epollDescriptor);
+				}
+#endif
 			}
 
-			inline virtual ~TCPConnection() = default;
-
 		  protected:
-			inline TCPConnection() = default;
+			struct ConnectionData {
+				ValueType* connection{};
+				bool writeReady{};
+				bool readReady{};
+			};
+
+			static constexpr uint64_t wakeKey{ std::numeric_limits<uint64_t>::max() };
+			UnorderedMap<uint64_t, ConnectionData> connections{};
+			Jsonifier::Vector<uint64_t> lostConnections{};
+			bool areThereReadsPending{};
+#if defined(__linux__)
+			std::array<epoll_event, 128> events{};
+			int32_t epollDescriptor{ SOCKET_ERROR };
+			int32_t wakeDescriptor{ SOCKET_ERROR };
+#else
+			Jsonifier::Vector<uint64_t> indices{};
+			Jsonifier::Vector<pollfd> polls{};
+#endif
+
+			/// @brief Drains a connection's pending writes and reads, until the socket would block.
+			/// @param value The connection to service.
+			/// @return False if the connection has been lost, true otherwise.
+			inline bool serviceConnection(ConnectionData& value) {
+				auto& connection = *value.connection;
+				if (connection.currentStatus != ConnectionStatus::NO_Error || !connection.areWeStillConnected()) {
+					return false;
+				}
+				if ((value.writeReady && (connection.outputBuffer.getUsedSpace() > 0 || connection.writeWantWrite)) || (value.readReady && connection.writeWantRead)) {
+					if (!connection.processWriteData()) {
+						connection.currentStatus = ConnectionStatus::WRITE_Error;
+						return false;
+					}
+					if (connection.writeWantWrite) {
+						value.writeReady = false;
+					}
+				}
+				while (value.readReady || (value.writeReady && connection.readWantWrite)) {
+					if (!connection.processReadData()) {
+						connection.currentStatus = ConnectionStatus::READ_Error;
+						return false;
+					}
+					if (connection.readWantWrite) {
+						value.writeReady = false;
+						break;
+					} else if (connection.readWantRead) {
+						value.readReady = false;
+					} else if (connection.inputBuffer.isItFull()) {
+						break;
+					}
+					if (!connection.areWeStillConnected()) {
+						return false;
+					}
+				}
+				return connection.areWeStillConnected();
+			}
 		};
 	}
 
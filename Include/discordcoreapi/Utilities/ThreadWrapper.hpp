@@ -151,6 +151,42 @@ namespace DiscordCoreAPI {
 			CountedPtr<std::atomic_bool> atomicBool{ makeCounted<std::atomic_bool>() };///< Managed atomic bool for stopping control.
 			std::thread currentThread{};///< Managed thread.
 		};
+
+		/// @brief Implemented by a thread pool that stands in another worker while one of its own workers is blocked.
+		class BlockingHandler {
+		  public:
+			/// @brief Called when a worker of the pool begins to block.
+			virtual void beginBlocking() = 0;
+
+			/// @brief Called when that worker stops blocking.
+			virtual void endBlocking() = 0;
+
+		  protected:
+			inline ~BlockingHandler() = default;
+		};
+
+		/// @brief Marks the calling thread as blocked for the lifetime of the region.
+		/// @details If the thread is a pool worker, its pool is told so that it can keep running queued tasks on a replacement worker - which is what keeps
+		/// a task that blocks on another task from starving it. Nested regions only report the outermost one.
+		class BlockingRegion {
+		  public:
+			inline BlockingRegion() noexcept {
+				if (handler && depth++ == 0) {
+					handler->beginBlocking();
+				}
+			}
+
+			inline ~BlockingRegion() noexcept {
+				if (handler && --depth == 0) {
+					handler->endBlocking();
+				}
+			}
+
+			inline static thread_local BlockingHandler* handler{};///< The pool that owns the calling thread, if any.
+
+		  protected:
+			inline static thread_local uint64_t depth{};///< The number of regions the calling thread is currently inside.
+		};
 		/**@}*/
 	}
 }
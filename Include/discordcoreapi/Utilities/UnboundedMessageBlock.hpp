@@ -34,67 +34,260 @@
 
 namespace DiscordCoreAPI {
 
-	/// @brief A thread-safe messaging block for data-structures.
+	/// @brief A thread-safe, lock-free messaging block for data-structures.
+	/// @details Values are stored in a linked list of fixed-size segments. Producers claim slots with a single fetch-add on the segment's enqueue index,
+	/// and consumers claim only slots that have been written. Fully-consumed segments are freed by epoch: once every operation that began before a
+	/// segment was unlinked has finished - however many operations have begun since.
 	/// @tparam ValueType The type of object that will be sent over the message block.
 	template<CopyableOrMovable ValueType> class UnboundedMessageBlock {
 	  public:
-		inline UnboundedMessageBlock(){};
+		using value_type = std::decay_t<ValueType>;
 
-		inline UnboundedMessageBlock<std::decay_t<ValueType>>& operator=(UnboundedMessageBlock<std::decay_t<ValueType>>&& other) {
+		inline UnboundedMessageBlock() {
+			Segment* newSegment = new Segment{};
+			headPtr.store(newSegment, std::memory_order_relaxed);
+			tailPtr.store(newSegment, std::memory_order_relaxed);
+		}
+
+		inline UnboundedMessageBlock<value_type>& operator=(UnboundedMessageBlock<value_type>&& other) {
 			if (this != &other) {
-				std::lock(accessMutex, other.accessMutex);
-				std::unique_lock lock{ accessMutex, std::adopt_lock };
-				std::unique_lock otherLock{ other.accessMutex, std::adopt_lock };
-				queue = std::move(other.queue);
+				clearContents();
+				value_type object{};
+				while (other.tryReceive(object)) {
+					send(std::move(object));
+				}
 			}
 			return *this;
 		}
 
-		inline UnboundedMessageBlock<std::decay_t<ValueType>>& operator=(const UnboundedMessageBlock<std::decay_t<ValueType>>&) = delete;
-		inline UnboundedMessageBlock(const UnboundedMessageBlock&)																= delete;
+		inline UnboundedMessageBlock<value_type>& operator=(const UnboundedMessageBlock<value_type>&) = delete;
+		inline UnboundedMessageBlock(const UnboundedMessageBlock&)									  = delete;
 
-		inline ~UnboundedMessageBlock() = default;
+		inline ~UnboundedMessageBlock() {
+			clearContents();
+			Segment* currentSegment = headPtr.load(std::memory_order_acquire);
+			while (currentSegment) {
+				Segment* nextSegment = currentSegment->next.load(std::memory_order_acquire);
+				delete currentSegment;
+				currentSegment = nextSegment;
+			}
+			for (auto& value: retiredSegments) {
+				freeSegments(value.exchange(nullptr, std::memory_order_acq_rel));
+			}
+		}
 
 		template<typename ValueTypeNew> inline void send(ValueTypeNew&& object) {
-			std::unique_lock lock{ accessMutex };
-			queue.emplace_back(std::forward<ValueTypeNew>(object));
+			value_type objectNew{ std::forward<ValueTypeNew>(object) };
+			{
+				OperationGuard guard{ *this };
+				while (true) {
+					Segment* tail = tailPtr.load(std::memory_order_acquire);
+					uint64_t index{ tail->enqueueIndex.fetch_add(1, std::memory_order_acq_rel) };
+					if (index < Segment::slotCount) {
+						Slot& slot{ tail->slots[index] };
+						new (slot.storage) value_type{ std::move(objectNew) };
+						uint8_t expected{ Slot::empty };
+						if (slot.state.compare_exchange_strong(expected, Slot::written, std::memory_order_release, std::memory_order_relaxed)) {
+							break;
+						}
+						objectNew = std::move(*slot.get());
+						slot.get()->~value_type();
+						continue;
+					}
+					if (tail != tailPtr.load(std::memory_order_acquire)) {
+						continue;
+					}
+					Segment* next = tail->next.load(std::memory_order_acquire);
+					if (!next) {
+						Segment* newSegment = new Segment{};
+						if (!tail->next.compare_exchange_strong(next, newSegment, std::memory_order_acq_rel, std::memory_order_acquire)) {
+							delete newSegment;
+							continue;
+						}
+						next = newSegment;
+					}
+					tailPtr.compare_exchange_strong(tail, next, std::memory_order_acq_rel, std::memory_order_relaxed);
+				}
+			}
+			currentSize.fetch_add(1, std::memory_order_release);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (waiterCount.load(std::memory_order_relaxed) > 0) {
+				std::unique_lock lock{ waitMutex };
+				lock.unlock();
+				waitCondition.notify_one();
+			}
 		}
 
 		inline void clearContents() {
-			std::unique_lock lock{ accessMutex };
-			queue.clear();
+			value_type object{};
+			while (tryReceive(object)) {
+			}
 		}
 
+		/// @brief Receives a value if one is ready, without waiting.
+		/// @details A slot whose producer has claimed it but not yet written it is waited on only briefly, and never taken from under that producer - so
+		/// the queue reads as empty until the value lands.
+		/// @param object The object to populate.
+		/// @return True if a value was received.
 		inline bool tryReceive(ValueType& object) {
-			std::unique_lock lock{ accessMutex };
-			if (queue.size() > 0) {
-				object = std::move(queue.front());
-				queue.pop_front();
+			OperationGuard guard{ *this };
+			while (true) {
+				Segment* head = headPtr.load(std::memory_order_acquire);
+				uint64_t index{ head->dequeueIndex.load(std::memory_order_acquire) };
+				if (index < Segment::slotCount) {
+					if (index >= head->enqueueIndex.load(std::memory_order_acquire)) {
+						return false;
+					}
+					Slot& slot{ head->slots[index] };
+					for (uint64_t x = 0; x < writeSpinCount && slot.state.load(std::memory_order_acquire) != Slot::written; ++x) {
+					}
+					if (slot.state.load(std::memory_order_acquire) != Slot::written) {
+						return false;
+					}
+					if (!head->dequeueIndex.compare_exchange_strong(index, index + 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+						continue;
+					}
+					slot.state.store(Slot::taken, std::memory_order_relaxed);
+					object = std::move(*slot.get());
+					slot.get()->~value_type();
+					currentSize.fetch_sub(1, std::memory_order_release);
+					return true;
+				}
+				Segment* next = head->next.load(std::memory_order_acquire);
+				if (!next) {
+					return false;
+				}
+				// A producer may not yet have moved the tail off of the segment it linked past, and nothing may reach a segment once it is retired.
+				Segment* tail{ head };
+				tailPtr.compare_exchange_strong(tail, next, std::memory_order_acq_rel, std::memory_order_relaxed);
+				if (headPtr.compare_exchange_strong(head, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+					retireSegment(head);
+				}
+			}
+		}
+
+		/// @brief Waits for a value to arrive, parking the calling thread rather than polling.
+		/// @param object The object to populate.
+		/// @param timeOut The maximum time to wait for.
+		/// @return True if a value was received before the timeout elapsed.
+		inline bool receive(ValueType& object, Milliseconds timeOut) {
+			if (tryReceive(object)) {
 				return true;
-			} else {
-				return false;
 			}
+			auto deadline = HRClock::now() + std::min(timeOut, Milliseconds{ std::numeric_limits<int32_t>::max() });
+			std::unique_lock lock{ waitMutex };
+			waiterCount.fetch_add(1, std::memory_order_seq_cst);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			bool didWeReceive{ false };
+			while (!(didWeReceive = tryReceive(object))) {
+				if (waitCondition.wait_until(lock, deadline) == std::cv_status::timeout) {
+					didWeReceive = tryReceive(object);
+					break;
+				}
+			}
+			waiterCount.fetch_sub(1, std::memory_order_release);
+			return didWeReceive;
 		}
 
 		inline uint64_t size() {
-			std::unique_lock lock{ accessMutex };
-			return queue.size();
+			int64_t sizeNew{ currentSize.load(std::memory_order_acquire) };
+			return sizeNew > 0 ? static_cast<uint64_t>(sizeNew) : 0;
 		}
 
 	  protected:
-		std::deque<std::decay_t<ValueType>> queue{};
-		std::mutex accessMutex{};
-	};
+		struct Slot {
+			static constexpr uint8_t empty{ 0 };
+			static constexpr uint8_t written{ 1 };
+			static constexpr uint8_t taken{ 2 };
 
-	template<typename ValueType> inline bool waitForTimeToPass(UnboundedMessageBlock<std::decay_t<ValueType>>& outBuffer, ValueType& argOne, uint64_t timeInMsNew) {
-		StopWatch<std::chrono::milliseconds> stopWatchNew{ Milliseconds{ timeInMsNew } };
-		while (!outBuffer.tryReceive(argOne)) {
-			std::this_thread::sleep_for(1ms);
-			if (stopWatchNew.hasTimePassed()) {
-				return true;
+			alignas(value_type) unsigned char storage[sizeof(value_type)];
+			std::atomic_uint8_t state{ empty };
+
+			inline value_type* get() {
+				return std::launder(reinterpret_cast<value_type*>(storage));
+			}
+		};
+
+		struct Segment {
+			static constexpr uint64_t slotCount{ 32 };
+
+			std::array<Slot, slotCount> slots{};
+			alignas(64) std::atomic_uint64_t enqueueIndex{};
+			alignas(64) std::atomic_uint64_t dequeueIndex{};
+			std::atomic<Segment*> next{};
+			Segment* nextRetired{};
+		};
+
+		/// @brief Counts an in-flight operation against the epoch it began in, so that segments are only freed once nobody can still be reading them.
+		struct OperationGuard {
+			inline OperationGuard(UnboundedMessageBlock& blockNew) : block{ blockNew } {
+				while (true) {
+					epoch = block.currentEpoch.load(std::memory_order_seq_cst);
+					block.activeOperations[epoch % epochCount].fetch_add(1, std::memory_order_seq_cst);
+					if (block.currentEpoch.load(std::memory_order_seq_cst) == epoch) {
+						break;
+					}
+					block.activeOperations[epoch % epochCount].fetch_sub(1, std::memory_order_seq_cst);
+				}
 			}
+
+			inline ~OperationGuard() {
+				block.activeOperations[epoch % epochCount].fetch_sub(1, std::memory_order_seq_cst);
+				block.reclaimSegments();
+			}
+
+			UnboundedMessageBlock& block;
+			uint64_t epoch{};
 		};
-		return false;
+
+		static constexpr uint64_t writeSpinCount{ 64 };
+		static constexpr uint64_t epochCount{ 3 };
+
+		alignas(64) std::atomic<Segment*> headPtr{};
+		alignas(64) std::atomic<Segment*> tailPtr{};
+		alignas(64) std::array<std::atomic<Segment*>, epochCount> retiredSegments{};
+		std::array<std::atomic_uint64_t, epochCount> activeOperations{};
+		std::atomic_uint64_t currentEpoch{};
+		std::condition_variable waitCondition{};
+		std::atomic_uint64_t waiterCount{};
+		std::atomic_int64_t currentSize{};
+		std::mutex waitMutex{};
+
+		/// @brief Files an unlinked segment under the current epoch.
+		inline void retireSegment(Segment* segment) {
+			std::atomic<Segment*>& retired{ retiredSegments[currentEpoch.load(std::memory_order_seq_cst) % epochCount] };
+			segment->nextRetired = retired.load(std::memory_order_relaxed);
+			while (!retired.compare_exchange_weak(segment->nextRetired, segment, std::memory_order_release, std::memory_order_relaxed)) {
+			}
+		}
+
+		/// @brief Advances the epoch once no operation from the one before it remains, freeing the segments retired two epochs back.
+		/// @details Operations only ever join the current epoch, so the previous one always drains - unlike waiting for no operations at all, which a
+		/// steady stream of them could put off forever.
+		inline void reclaimSegments() {
+			uint64_t epoch{ currentEpoch.load(std::memory_order_seq_cst) };
+			if (!retiredSegments[(epoch + 1) % epochCount].load(std::memory_order_relaxed) && !retiredSegments[(epoch + 2) % epochCount].load(std::memory_order_relaxed) &&
+				!retiredSegments[epoch % epochCount].load(std::memory_order_relaxed)) {
+				return;
+			}
+			if (activeOperations[(epoch + 2) % epochCount].load(std::memory_order_seq_cst) != 0 ||
+				!currentEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+				return;
+			}
+			freeSegments(retiredSegments[(epoch + 2) % epochCount].exchange(nullptr, std::memory_order_acq_rel));
+		}
+
+		inline static void freeSegments(Segment* segments) {
+			while (segments) {
+				Segment* next = segments->nextRetired;
+				delete segments;
+				segments = next;
+			}
+		}
+	};
+
+	template<typename ValueType> inline bool waitForTimeToPass(UnboundedMessageBlock<std::decay_t<ValueType>>& outBuffer, ValueType& argOne, uint64_t timeInMsNew) {
+		return !outBuffer.receive(argOne, Milliseconds{ timeInMsNew });
 	}
 
 }
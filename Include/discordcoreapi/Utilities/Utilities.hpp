@@ -36,6 +36,7 @@
 #include <discordcoreapi/Utilities/ObjectCache.hpp>
 #include <discordcoreapi/Utilities/RingBuffer.hpp>
 #include <discordcoreapi/Utilities/UnboundedMessageBlock.hpp>
+#include <discordcoreapi/Utilities/AudioFramePool.hpp>
 #include <discordcoreapi/Utilities/Etf.hpp>
 #include <coroutine>
 
@@ -96,6 +97,7 @@ namespace DiscordCoreAPI {
 	class VoiceConnection;
 	class GuildMemberData;
 	class GuildMembers;
+	class OverWriteData;
 	class ChannelData;
 	class Reactions;
 	class RoleData;
@@ -196,6 +198,12 @@ namespace DiscordCoreAPI {
 		Json = 0x01///< Json format.
 	};
 
+	/// @brief Represents which transport compression to use for websocket transfer.
+	enum class GatewayCompression : uint8_t {
+		None		= 0x00,///< No compression.
+		Zlib_Stream = 0x01///< zlib-stream compression - requires the library to have been built with zlib.
+	};
+
 	/// @brief Sharding options for the library.
 	struct ShardingOptions {
 		uint32_t numberOfShardsForThisProcess{ 1 };///< The number of shards to launch on the current process.
@@ -216,10 +224,35 @@ namespace DiscordCoreAPI {
 	/// @brief For selecting the caching style of the library.
 	struct CacheOptions {
 		bool cacheGuildMembers{ true };///< Do we cache GuildMembers?
+		bool compactGuildMembers{ false };///< Do we store cached GuildMembers column-wise per Guild, trading lookup speed for memory?
+		bool cachePermissions{ false };///< Do we memoize computed Permissions per (Guild, member, Channel)?
+		uint32_t negativeCacheTtlInMs{ 0 };///< How long a 404 from a cache-miss fetch is remembered for - zero disables it.
 		bool cacheChannels{ true };///< Do we cache Channels?
 		bool cacheGuilds{ true };///< Do we cache Guilds?
 		bool cacheRoles{ true };///< Do we cache Roles?
 		bool cacheUsers{ true };///< Do we cache Users?
+		ObjectCacheLimits guildMemberLimits{};///< Capacity and time-to-live of the GuildMember cache.
+		ObjectCacheLimits channelLimits{};///< Capacity and time-to-live of the Channel cache.
+		ObjectCacheLimits guildLimits{};///< Capacity and time-to-live of the Guild cache.
+		ObjectCacheLimits roleLimits{};///< Capacity and time-to-live of the Role cache.
+		ObjectCacheLimits userLimits{};///< Capacity and time-to-live of the User cache.
+		uint64_t memoryBudgetInBytes{ 0 };///< An estimated memory budget shared by every bounded cache - zero disables it.
+		std::string snapshotPath{};///< A file to snapshot the caches to on shutdown and to reload them from on start-up - empty disables it.
+		uint32_t snapshotIntervalInMs{ 0 };///< How often the caches are also snapshotted while running - zero snapshots only on shutdown.
+	};
+
+	/// @brief For configuring the pooling of the library's Https connections.
+	struct HttpsOptions {
+		uint32_t minConnectionsPerHost{ 1 };///< The number of idle connections that are kept alive for each host.
+		uint32_t maxConnectionsPerHost{ 16 };///< The maximum number of simultaneous connections to a single host.
+		uint32_t maxRequestsPerBucket{ 4 };///< The maximum number of simultaneous requests within a single rate-limit bucket.
+		uint32_t idleTimeoutInMs{ 30000 };///< How long an idle connection above the minimum is kept alive for.
+	};
+
+	/// @brief For configuring how far ahead of playback Songs are downloaded.
+	struct StreamingOptions {
+		uint32_t readAheadInSeconds{ 30 };///< How many seconds of audio to queue ahead of playback, before the download waits for it to be played.
+		uint32_t maxRequestsInFlight{ 4 };///< The maximum number of range requests downloaded, or downloading, ahead of the queue, for a single Song.
 	};
 
 	/// @brief Configuration data for the library's main class, DiscordCoreClient.
@@ -228,10 +261,13 @@ namespace DiscordCoreAPI {
 		Jsonifier::Vector<RepeatedFunctionData> functionsToExecute{};///< Functions to execute after a timer, or on a repetition.
 		GatewayIntents intents{ GatewayIntents::All_Intents };///< The gateway intents to be used for this instance.
 		TextFormat textFormat{ TextFormat::Etf };///< Use ETF or JSON format for websocket transfer?
+		GatewayCompression compression{ GatewayCompression::None };///< Transport compression to request for websocket transfer.
 		std::string connectionAddress{};///< A potentially alternative connection address for the websocket.
 		ShardingOptions shardOptions{};///< Options for the sharding of your bot.
 		LoggingOptions logOptions{};///< Options for the output/logging of the library.
 		CacheOptions cacheOptions{};///< Options for the cache of the library.
+		HttpsOptions httpsOptions{};///< Options for the Https connections of the library.
+		StreamingOptions streamingOptions{};///< Options for the downloading of Songs.
 		uint16_t connectionPort{};///< A potentially alternative connection port for the websocket.
 		std::string botToken{};///< Your bot's token.
 	};
@@ -261,6 +297,16 @@ namespace DiscordCoreAPI {
 
 		bool doWeCacheGuildMembers() const;
 
+		bool doWeCompactGuildMembers() const;
+
+		bool doWeCachePermissions() const;
+
+		Milliseconds getNegativeCacheTtl() const;
+
+		std::string getSnapshotPath() const;
+
+		Milliseconds getSnapshotInterval() const;
+
 		bool doWeCacheChannels() const;
 
 		bool doWeCacheUsers() const;
@@ -269,6 +315,12 @@ namespace DiscordCoreAPI {
 
 		bool doWeCacheRoles() const;
 
+		HttpsOptions getHttpsOptions() const;
+
+		StreamingOptions getStreamingOptions() const;
+
+		CacheOptions getCacheOptions() const;
+
 		UpdatePresenceData getPresenceData() const;
 
 		std::string getBotToken() const;
@@ -291,6 +343,8 @@ namespace DiscordCoreAPI {
 
 		TextFormat getTextFormat() const;
 
+		GatewayCompression getGatewayCompression() const;
+
 		GatewayIntents getGatewayIntents();
 
 	  protected:
@@ -361,14 +415,21 @@ namespace DiscordCoreAPI {
 	};
 
 	/// @brief Represents a single frame of audio data.
+	/// @details The data's buffer is taken from, and handed back to, the AudioFramePool - it can be larger than the frame it holds.
 	struct DiscordCoreAPI_Dll AudioFrameData {
 		AudioFrameType type{ AudioFrameType::Unset };///< The type of audio frame.
 		Jsonifier::Vector<uint8_t> data{};///< The audio data.
 		uint64_t guildMemberId{};///< GuildMemberId for the sending GuildMemberData.
-		int64_t currentSize{};///< The current size of the allocated memory.
+		int64_t currentSize{};///< The size of the frame held in the data.
 
 		AudioFrameData() = default;
 
+		AudioFrameData& operator=(AudioFrameData&&) noexcept;
+		AudioFrameData(AudioFrameData&&) noexcept;
+
+		AudioFrameData& operator=(const AudioFrameData&) = default;
+		AudioFrameData(const AudioFrameData&)			 = default;
+
 		AudioFrameData(AudioFrameType frameType);
 
 		AudioFrameData& operator+=(std::basic_string_view<uint8_t>);
@@ -378,6 +439,8 @@ namespace DiscordCoreAPI {
 		}
 
 		void clearData();
+
+		~AudioFrameData();
 	};
 
 	/// For connecting to a voice-channel. "streamInfo" is used when a socket is created to connect this bot to another bot, for transmitting audio back and forth.
@@ -518,6 +581,89 @@ namespace DiscordCoreAPI {
 		Send_Voice_Messages					= 0x0000400000000000,///< Allows sending voice messages.
 	};
 
+	/// @brief Evaluates Permissions as uint64_t bitmasks, straight from the Role and Channel caches.
+	/// @details Results can optionally be memoized per (Guild, member, Channel) - the memo is invalidated by the Role, Channel, Guild and GuildMember events,
+	/// and an entry is only served to a GuildMemberData carrying the same Roles it was computed from.
+	class DiscordCoreAPI_Dll PermissionEvaluator {
+	  public:
+		/// @brief Every Permission that can currently be held - every bit up to and including the highest one, Send_Voice_Messages.
+		static constexpr uint64_t allPermissions{ (static_cast<uint64_t>(Permission::Send_Voice_Messages) << 1) - 1 };
+
+		static void initialize(ConfigManager* configManagerNew);
+
+		/// @brief Computes a GuildMember's base Permissions within their Guild.
+		/// @param guildMember The GuildMemberData who's Permissions to compute.
+		/// @return The Permissions, as a bitmask.
+		static uint64_t computeBasePermissions(const GuildMemberData& guildMember);
+
+		/// @brief Applies a Channel's overwrites to a GuildMember's base Permissions.
+		/// @param basePermissions The GuildMember's base Permissions.
+		/// @param guildMember The GuildMemberData who's Permissions to compute.
+		/// @param channel The ChannelData who's overwrites to apply.
+		/// @return The Permissions, as a bitmask.
+		static uint64_t computeOverwrites(uint64_t basePermissions, const GuildMemberData& guildMember, const ChannelData& channel);
+
+		/// @brief Computes a GuildMember's Permissions within a Channel, from the memo if it is enabled.
+		/// @param guildMember The GuildMemberData who's Permissions to compute.
+		/// @param channel The ChannelData within which to compute them.
+		/// @return The Permissions, as a bitmask.
+		static uint64_t computePermissions(const GuildMemberData& guildMember, const ChannelData& channel);
+
+		/// @brief Computes a GuildMember's Permissions within a cached Channel, reading its overwrites in place.
+		/// @param guildMember The GuildMemberData who's Permissions to compute.
+		/// @param channelId The id of the Channel within which to compute them.
+		/// @return The Permissions, as a bitmask.
+		static uint64_t computePermissions(const GuildMemberData& guildMember, Snowflake channelId);
+
+		/// @brief Checks for a given Permission in a chosen Channel, for a specific GuildMember.
+		/// @param guildMember The GuildMemberData who's Permissions to check.
+		/// @param channel The ChannelData within which to check for the Permission.
+		/// @param permission The Permission to check for.
+		/// @return bool A bool suggesting the presence of the chosen Permission.
+		static bool checkForPermission(const GuildMemberData& guildMember, const ChannelData& channel, Permission permission);
+
+		/// @brief Drops every memoized result for a Guild - for when its Roles or owner change.
+		/// @details The invalidate functions are to be called after the cache write they answer to, so that no result computed from the old data can be
+		/// memoized after them.
+		static void invalidateGuild(Snowflake guildId);
+
+		/// @brief Drops the memoized results for a single Channel of a Guild.
+		static void invalidateChannel(Snowflake guildId, Snowflake channelId);
+
+		/// @brief Drops the memoized results for a single member of a Guild.
+		static void invalidateMember(Snowflake guildId, Snowflake userId);
+
+	  protected:
+		static constexpr uint64_t maxMemoSizePerGuild{ 8192 };
+
+		/// @brief A memoized result for one (member, Channel) pair of a Guild.
+		struct MemoEntry {
+			uint64_t permissions{};
+			uint64_t rolesHash{};
+			Snowflake channelId{};
+			Snowflake userId{};
+		};
+
+		static UnorderedMap<uint64_t, UnorderedMap<uint64_t, MemoEntry>> memo;
+		static UnorderedMap<uint64_t, uint64_t> generations;///< Bumped by each invalidation of a Guild, so a result computed across one is not memoized.
+		static std::shared_mutex memoMutex;
+		static bool doWeMemoize;
+
+		static uint64_t computeOverwrites(uint64_t basePermissions, const GuildMemberData& guildMember, const Jsonifier::Vector<OverWriteData>& permissionOverwrites);
+
+		static bool findMemo(const GuildMemberData& guildMember, Snowflake channelId, uint64_t& permissions, uint64_t& generation);
+
+		static void insertMemo(const GuildMemberData& guildMember, Snowflake channelId, uint64_t permissions, uint64_t generation);
+
+		static uint64_t getMemoKey(Snowflake userId, Snowflake channelId);
+
+		static uint64_t getRolesHash(const Jsonifier::Vector<Snowflake>& roles);
+
+		static Snowflake getGuildOwnerId(Snowflake guildId);
+
+		static uint64_t getRolePermissions(Snowflake guildId, Snowflake roleId);
+	};
+
 	/// @brief PermissionsBase class, for representing and manipulating Permission data.
 	template<typename ValueType> class PermissionsBase {
 	  public:
@@ -542,19 +688,14 @@ namespace DiscordCoreAPI {
 		/// @param permission A Permission to check the current ChannelData for.
 		/// @return bool A bool suggesting the presence of the chosen Permission.
 		inline bool checkForPermission(const GuildMemberData& guildMember, const ChannelData& channel, Permission permission) {
-			if ((stoull(computePermissions(guildMember, channel)) & static_cast<uint64_t>(permission)) == static_cast<uint64_t>(permission)) {
-				return true;
-			} else {
-				return false;
-			}
+			return PermissionEvaluator::checkForPermission(guildMember, channel, permission);
 		}
 
 		/// @brief Returns a string containing the currently held PermissionsBase in a given Guild.
 		/// @param guildMember The GuildMemberData who's PermissionsBase are to be evaluated.
 		/// @return std::string A string containing the current PermissionsBase.
 		inline static std::string getCurrentGuildPermissions(const GuildMemberData& guildMember) {
-			PermissionsBase setValue(computeBasePermissions(guildMember));
-			return static_cast<ValueType*>(setValue);
+			return computeBasePermissions(guildMember);
 		}
 
 		/// @brief Removes one or more PermissionsBase from the current PermissionsBase value.
@@ -739,28 +880,24 @@ namespace DiscordCoreAPI {
 		/// @brief Returns a string containing ALL of the possible PermissionsBase.
 		/// @return std::string A string containing all of the possible PermissionsBase.
 		inline static std::string getAllPermissions() {
-			uint64_t allPerms{};
-			for (int64_t x = 0; x < 46; ++x) {
-				allPerms |= 1ll << x;
-			}
-			std::stringstream stream{};
-			stream << allPerms;
-			return stream.str();
+			return std::to_string(PermissionEvaluator::allPermissions);
 		}
 
 	  protected:
 		inline ~PermissionsBase() = default;
 		inline PermissionsBase()  = default;
 
-		DiscordCoreAPI_Dll static std::string computeOverwrites(const std::string& basePermissions, const GuildMemberData& guildMember, const ChannelData& channel);
+		inline static std::string computeOverwrites(const std::string& basePermissions, const GuildMemberData& guildMember, const ChannelData& channel) {
+			return std::to_string(PermissionEvaluator::computeOverwrites(stoull(basePermissions), guildMember, channel));
+		}
 
 		inline static std::string computePermissions(const GuildMemberData& guildMember, const ChannelData& channel) {
-			std::string permissions = computeBasePermissions(guildMember);
-			permissions				= computeOverwrites(permissions, guildMember, channel);
-			return permissions;
+			return std::to_string(PermissionEvaluator::computePermissions(guildMember, channel));
 		}
 
-		DiscordCoreAPI_Dll static std::string computeBasePermissions(const GuildMemberData& guildMember);
+		inline static std::string computeBasePermissions(const GuildMemberData& guildMember) {
+			return std::to_string(PermissionEvaluator::computeBasePermissions(guildMember));
+		}
 	};
 
 	class PermissionsParse : public PermissionsBase<PermissionsParse>, public std::string {
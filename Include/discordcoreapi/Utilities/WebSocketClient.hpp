@@ -33,6 +33,7 @@
 #include <discordcoreapi/Utilities/AudioDecoder.hpp>
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/EventEntities.hpp>
+#include <discordcoreapi/Utilities/GatewayInflater.hpp>
 #include <discordcoreapi/Utilities/TCPConnection.hpp>
 #include <discordcoreapi/Utilities/Etf.hpp>
 #include <thread>
@@ -117,14 +118,72 @@ namespace DiscordCoreAPI {
 			}
 		};
 
+		/// @brief Gateway dispatch names, indexed by the event number used in WebSocketClient::onMessageReceived.
+		constexpr std::array<std::string_view, 61> eventNames{
+			"", "READY", "RESUMED", "APPLICATION_COMMAND_PERMISSIONS_UPDATE", "AUTO_MODERATION_RULE_CREATE", "AUTO_MODERATION_RULE_UPDATE",
+			"AUTO_MODERATION_RULE_DELETE", "AUTO_MODERATION_ACTION_EXECUTION", "CHANNEL_CREATE", "CHANNEL_UPDATE", "CHANNEL_DELETE", "CHANNEL_PINS_UPDATE",
+			"THREAD_CREATE", "THREAD_UPDATE", "THREAD_DELETE", "THREAD_LIST_SYNC", "THREAD_MEMBER_UPDATE", "THREAD_MEMBERS_UPDATE", "GUILD_CREATE",
+			"GUILD_UPDATE", "GUILD_DELETE", "GUILD_BAN_ADD", "GUILD_BAN_REMOVE", "GUILD_EMOJIS_UPDATE", "GUILD_STICKERS_UPDATE",
+			"GUILD_INTEGRATIONS_UPDATE", "GUILD_MEMBER_ADD", "GUILD_MEMBER_REMOVE", "GUILD_MEMBER_UPDATE", "GUILD_MEMBERS_CHUNK", "GUILD_ROLE_CREATE",
+			"GUILD_ROLE_UPDATE", "GUILD_ROLE_DELETE", "GUILD_SCHEDULED_EVENT_CREATE", "GUILD_SCHEDULED_EVENT_UPDATE", "GUILD_SCHEDULED_EVENT_DELETE",
+			"GUILD_SCHEDULED_EVENT_USER_ADD", "GUILD_SCHEDULED_EVENT_USER_REMOVE", "INTEGRATION_CREATE", "INTEGRATION_UPDATE", "INTEGRATION_DELETE",
+			"INTERACTION_CREATE", "INVITE_CREATE", "INVITE_DELETE", "MESSAGE_CREATE", "MESSAGE_UPDATE", "MESSAGE_DELETE", "MESSAGE_DELETE_BULK",
+			"MESSAGE_REACTION_ADD", "MESSAGE_REACTION_REMOVE", "MESSAGE_REACTION_REMOVE_ALL", "MESSAGE_REACTION_REMOVE_EMOJI", "PRESENCE_UPDATE",
+			"STAGE_INSTANCE_CREATE", "STAGE_INSTANCE_UPDATE", "STAGE_INSTANCE_DELETE", "TYPING_START", "USER_UPDATE", "VOICE_STATE_UPDATE",
+			"VOICE_SERVER_UPDATE", "WEBHOOKS_UPDATE"
+		};
+
+		constexpr uint64_t eventTableSize{ 1024 };
+
+		constexpr uint64_t hashEventName(std::string_view eventNew, uint64_t seed) {
+			uint64_t hash{ 14695981039346656037ull ^ seed };
+			for (auto& value: eventNew) {
+				hash ^= static_cast<uint8_t>(value);
+				hash *= 1099511628211ull;
+			}
+			return hash ^ (hash >> 32);
+		}
+
+		/// @brief Finds a seed for which every event name lands in its own slot of the event table.
+		constexpr uint64_t findEventSeed() {
+			for (uint64_t seed = 0; seed < eventTableSize; ++seed) {
+				std::array<bool, eventTableSize> slots{};
+				bool doWeCollide{};
+				for (uint64_t x = 1; x < eventNames.size() && !doWeCollide; ++x) {
+					auto& slot	= slots[hashEventName(eventNames[x], seed) & (eventTableSize - 1)];
+					doWeCollide = slot;
+					slot		= true;
+				}
+				if (!doWeCollide) {
+					return seed;
+				}
+			}
+			return eventTableSize;
+		}
+
+		constexpr uint64_t eventSeed{ findEventSeed() };
+		static_assert(eventSeed < eventTableSize, "No collision-free seed was found for the event table.");
+
+		constexpr std::array<uint8_t, eventTableSize> createEventTable() {
+			std::array<uint8_t, eventTableSize> table{};
+			for (uint64_t x = 1; x < eventNames.size(); ++x) {
+				table[hashEventName(eventNames[x], eventSeed) & (eventTableSize - 1)] = static_cast<uint8_t>(x);
+			}
+			return table;
+		}
+
+		constexpr std::array<uint8_t, eventTableSize> eventTable{ createEventTable() };
+
+		/// @brief Maps a gateway dispatch name to its event index through a compile-time perfect-hash table.
 		class DiscordCoreAPI_Dll EventConverter {
 		  public:
-			EventConverter(std::string eventNew);
+			EventConverter(std::string_view eventNew);
 
 			operator uint64_t();
 
 		  protected:
-			std::string eventValue{};
+			std::string_view eventValue{};
+			std::string eventStorage{};
 		};
 
 		/// @brief For the opcodes that could be sent/received via Discord's websockets.
@@ -194,9 +253,26 @@ namespace DiscordCoreAPI {
 
 			bool areWeConnected();
 
-			bool parseMessage();
+			/// @brief Reassembles and dispatches the frames in a chunk of received bytes.
+			/// @details Frames that lie wholly within the chunk are handed on as views straight into it. Only a frame that is split across reads is
+			/// buffered, and only until its last byte arrives.
+			/// @param chunk The bytes most recently read from the connection.
+			/// @return `true` if the chunk was consumed, `false` if a close frame or a protocol error stopped it.
+			bool processFrames(std::string_view chunk);
 
-			void disconnect();
+			/// @brief Handles a single complete frame, collecting Op_Continuation fragments until their message is whole.
+			/// @param frame The frame, header included.
+			/// @return `true` if frames should keep being processed.
+			bool handleFrame(std::string_view frame);
+
+			/// @brief Decodes a frame header in place.
+			/// @param data The bytes at the start of a frame.
+			/// @return How many bytes the frame spans - or, if not enough bytes are present to know yet, how many are needed to learn it.
+			static uint64_t getFrameSize(std::string_view data);
+
+			/// @brief Sends a close frame and drops the connection.
+			/// @param closeCode The close code to send - 1000 and 1001 end a gateway session, whereas any other code leaves it resumable.
+			void disconnect(uint16_t closeCode = 1000);
 
 			virtual ~WebSocketCore() = default;
 
@@ -214,12 +290,17 @@ namespace DiscordCoreAPI {
 			WebSocketOpCode dataOpCode{};
 			bool areWeHeartBeating{};
 			Jsonifier::String currentMessage{};
+			Jsonifier::String fragmentBuffer{};
+			WebSocketOpCode fragmentOpCode{};
+			GatewayInflater inflater{};
 			WebSocketType wsType{};
+			bool doWeInflate{};
 			bool areWeResuming{};
 		};
 
 		class WebSocketClient : public WebSocketCore {
 		  public:
+			static constexpr uint16_t resumableCloseCode{ 4000 };///< Closes without ending the session, for a shutdown that a snapshot will resume from.
 			friend struct DiscordCoreAPI::OnVoiceServerUpdateData;
 			friend struct DiscordCoreAPI::OnVoiceStateUpdateData;
 			friend class TCPConnection<WebSocketTCPConnection>;
@@ -240,6 +321,10 @@ namespace DiscordCoreAPI {
 
 			void getVoiceConnectionData(const VoiceConnectInitData& doWeCollect);
 
+			static bool scanEnvelope(std::string_view dataNew, WebSocketMessage& message, std::string_view& payload);
+
+			bool isEventWanted(uint64_t eventIndex);
+
 			bool onMessageReceived(std::string_view message);
 
 			void disconnect();
@@ -253,6 +338,7 @@ namespace DiscordCoreAPI {
 			VoiceConnectionData voiceConnectionData{};
 			DiscordCoreClient* discordCoreClient{};
 			std::atomic_bool* doWeQuit{};
+			uint64_t interestMask{};
 			bool serverUpdateCollected{};
 			bool stateUpdateCollected{};
 			std::string resumeUrl{};
@@ -273,10 +359,18 @@ namespace DiscordCoreAPI {
 
 			WebSocketClient& getClient(uint32_t index);
 
+			/// @brief Hands a shard's client to this agent, which starts connecting it on its next pass.
+			/// @param index The shard's index.
+			/// @param client The client, fully set up - it may be connected as soon as it is added.
+			void addClient(uint32_t index, UniquePtr<WebSocketClient>&& client);
+
 			~BaseSocketAgent();
 
 		  protected:
-			UnorderedMap<uint64_t, WebSocketClient> shardMap{};
+			static constexpr Milliseconds maxReactorWaitTime{ 1000 };
+			TCPConnectionReactor<WebSocketTCPConnection> reactor{};
+			UnorderedMap<uint64_t, UniquePtr<WebSocketClient>> shardMap{};///< Held by pointer, as the reactor and VoiceConnections keep addresses that must survive a rehash.
+			std::mutex shardMutex{};///< Guards shardMap's structure, as shards are added while the agent is already running.
 			DiscordCoreClient* discordCoreClient{};
 			UniquePtr<ThreadWrapper> taskThread{};
 			uint64_t currentBaseSocketAgent{};
@@ -267,6 +267,43 @@ namespace DiscordCoreAPI {
 		VoiceConnection* voiceConnection{};
 	};
 
+	/// @brief Paces every active VoiceConnection from a small, fixed set of threads.
+	/// @details Connections are assigned to a worker by guild id, and each worker wakes once every 20 ms to send the next frame for every connection it
+	/// owns - instead of each connection sleeping and spinning on a thread of its own.
+	class DiscordCoreAPI_Dll VoiceSendScheduler {
+	  public:
+		VoiceSendScheduler();
+
+		/// @brief Starts ticking a connected VoiceConnection.
+		/// @param connection The connection to add.
+		void addConnection(VoiceConnection* connection);
+
+		/// @brief Stops ticking a VoiceConnection, waiting for any in-progress tick of it to finish.
+		/// @param connection The connection to remove.
+		void removeConnection(VoiceConnection* connection);
+
+		~VoiceSendScheduler();
+
+	  protected:
+		struct Worker {
+			Jsonifier::Vector<VoiceConnection*> connections{};
+			DiscordCoreInternal::ThreadWrapper thread{};
+			std::condition_variable tickCondition{};///< Signalled each time a connection's tick finishes.
+			std::atomic<std::thread::id> threadId{};
+			VoiceConnection* currentConnection{};///< The connection being ticked, outside of the lock.
+			std::condition_variable condition{};
+			std::mutex accessMutex{};
+		};
+
+		static constexpr Milliseconds tickInterval{ 20 };
+
+		Jsonifier::Vector<UniquePtr<Worker>> workers{};
+
+		Worker& getWorker(VoiceConnection* connection);
+
+		void run(DiscordCoreInternal::StopToken stopToken, Worker& worker);
+	};
+
 	/**
 	 * \addtogroup voice_connection
 	 * @{
@@ -278,6 +315,7 @@ namespace DiscordCoreAPI {
 		friend class DiscordCoreInternal::SoundCloudAPI;
 		friend class DiscordCoreInternal::YouTubeAPI;
 		friend class VoiceConnectionBridge;
+		friend class VoiceSendScheduler;
 		friend class VoiceUDPConnection;
 		friend class DiscordCoreClient;
 		friend class GuildCacheData;
@@ -305,10 +343,10 @@ namespace DiscordCoreAPI {
 	  protected:
 		std::atomic<VoiceConnectionState> connectionState{ VoiceConnectionState::Collecting_Init_Data };
 		UnboundedMessageBlock<DiscordCoreInternal::VoiceConnectionData> voiceConnectionDataBuffer{};
-		Nanoseconds intervalCount{ static_cast<int64_t>(960.0l / 48000.0l * 1000000000.0l) };
 		std::coroutine_handle<DiscordCoreAPI::CoRoutine<void, false>::promise_type> token{};
 		std::atomic<VoiceActiveState> prevActiveState{ VoiceActiveState::Stopped };
 		std::atomic<VoiceActiveState> activeState{ VoiceActiveState::Connecting };
+		VoiceActiveState lastTickState{ VoiceActiveState::Connecting };
 		DiscordCoreInternal::VoiceConnectionData voiceConnectionData{};
 		UnorderedMap<uint64_t, UniquePtr<VoiceUser>> voiceUsers{};
 		DiscordCoreInternal::OpusEncoderWrapper encoder{};
@@ -324,6 +362,7 @@ namespace DiscordCoreAPI {
 		int64_t nsPerSecond{ 1000000000 };
 		std::string audioEncryptionMode{};
 		AudioFrameData xferAudioData{};
+		std::atomic_bool areWeScheduled{};
 		std::atomic_bool wasItAFail{};
 		std::atomic_bool* doWeQuit{};
 		std::atomic_bool doWeSkip{};
@@ -349,6 +388,10 @@ namespace DiscordCoreAPI {
 
 		CoRoutine<void, false> runVoice();
 
+		void sendNextFrame();
+
+		bool processTick();
+
 		void sendVoiceConnectionData();
 
 		bool areWeCurrentlyPlaying();
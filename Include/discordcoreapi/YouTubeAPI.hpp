@@ -70,6 +70,7 @@ namespace DiscordCoreAPI {
 
 		  protected:
 			std::atomic_bool areWeWorkingBool{ false };
+			StreamingOptions streamingOptions{};
 			Snowflake guildId{};
 		};
 
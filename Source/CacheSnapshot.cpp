@@ -0,0 +1,586 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++
+   CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// CacheSnapshot.cpp - Source file for the CacheSnapshot class.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file CacheSnapshot.cpp
+
+#include <discordcoreapi/ChannelEntities.hpp>
+#include <discordcoreapi/GuildEntities.hpp>
+#include <discordcoreapi/GuildMemberEntities.hpp>
+#include <discordcoreapi/RoleEntities.hpp>
+#include <discordcoreapi/UserEntities.hpp>
+#include <discordcoreapi/Utilities/CacheSnapshot.hpp>
+#include <filesystem>
+#include <fstream>
+
+#ifndef _WIN32
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+namespace DiscordCoreAPI {
+
+	namespace DiscordCoreInternal {
+
+		/// @brief The fixed-size preamble of a snapshot file.
+		struct SnapshotHeader {
+			uint32_t magic{};
+			uint32_t formatVersion{};
+			uint64_t layoutHash{};
+			uint64_t botTokenHash{};
+			uint32_t totalShardCount{};
+			uint32_t sessionCount{};
+		};
+
+		constexpr uint32_t snapshotMagic{ 0x53414344 };
+		constexpr uint64_t snapshotBatchSize{ 4096 };
+
+		/// @brief Fingerprints this build's cached types, so that a snapshot written by a different build is not misread.
+		inline uint64_t getLayoutHash() {
+			uint64_t sizes[]{ sizeof(void*), sizeof(GuildCacheData), sizeof(ChannelCacheData), sizeof(RoleCacheData), sizeof(GuildMemberCacheData),
+				sizeof(UserCacheData) };
+			return KeyHasher{}(std::string_view{ reinterpret_cast<const char*>(sizes), sizeof(sizes) });
+		}
+
+		/// @brief The persisted fields of each cached type, in on-disk order.
+		template<typename ValueType> inline auto tieFields(ValueType& value) {
+			using value_type = std::remove_const_t<ValueType>;
+			if constexpr (std::same_as<value_type, GuildCacheData>) {
+				return std::tie(value.id, value.channels, value.members, value.emoji, value.roles, value.discoverySplash, value.name, value.memberCount, value.joinedAt,
+					value.discovery, value.ownerId, value.flags, value.banner, value.splash, value.icon);
+			} else if constexpr (std::same_as<value_type, ChannelCacheData>) {
+				return std::tie(value.id, value.permissionOverwrites, value.type, value.topic, value.name, value.memberCount, value.parentId, value.flags, value.position,
+					value.ownerId, value.guildId);
+			} else if constexpr (std::same_as<value_type, RoleCacheData>) {
+				return std::tie(value.id, value.permissions, value.unicodeEmoji, value.guildId, value.position, value.flags, value.color, value.name);
+			} else if constexpr (std::same_as<value_type, GuildMemberCacheData>) {
+				return std::tie(value.guildId, value.user, value.roles, value.permissions, value.flags, value.joinedAt, value.avatar, value.nick);
+			} else {
+				return std::tie(value.id, value.avatarDecoration, value.premiumType, value.accentColor, value.discriminator, value.banner, value.avatar, value.globalName,
+					value.userName, value.flags);
+			}
+		}
+
+		/// @brief Serializes values into a growing buffer.
+		class SnapshotWriter {
+		  public:
+			std::string buffer{};
+
+			template<typename ValueType>
+				requires(std::is_trivially_copyable_v<ValueType>)
+			inline void write(const ValueType& value) {
+				buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+			}
+
+			inline void write(const Snowflake& value) {
+				write(value.operator const uint64_t&());
+			}
+
+			inline void write(const UserIdBase& value) {
+				write(value.id);
+			}
+
+			inline void write(const TimeStamp& value) {
+				write(static_cast<int64_t>(value));
+			}
+
+			inline void write(const Permissions& value) {
+				write(static_cast<int64_t>(value));
+			}
+
+			inline void write(const OverWriteData& value) {
+				write(value.type);
+				write(value.allow);
+				write(value.deny);
+				write(value.id);
+			}
+
+			inline void write(const std::string& value) {
+				writeString(value.data(), value.size());
+			}
+
+			inline void write(const Jsonifier::String& value) {
+				writeString(value.data(), value.size());
+			}
+
+			template<typename ValueType> inline void write(const Jsonifier::Vector<ValueType>& value) {
+				write(static_cast<uint64_t>(value.size()));
+				for (auto& valueNew: value) {
+					write(valueNew);
+				}
+			}
+
+			inline void write(const UnorderedSet<Snowflake>& value) {
+				write(static_cast<uint64_t>(value.size()));
+				for (auto& valueNew: value) {
+					write(valueNew);
+				}
+			}
+
+			template<typename ValueType> inline void writeObject(const ValueType& value) {
+				std::apply(
+					[&](const auto&... fields) {
+						(write(fields), ...);
+					},
+					tieFields(value));
+			}
+
+			/// @brief Walks a cache, writing its object count and then its objects.
+			template<typename CacheType> inline void writeSection(CacheType& cache) {
+				uint64_t countOffset{ buffer.size() };
+				uint64_t count{};
+				write(count);
+				cache.visitAll([&](const auto& value) {
+					writeObject(value);
+					++count;
+				});
+				std::memcpy(buffer.data() + countOffset, &count, sizeof(count));
+			}
+
+		  protected:
+			inline void writeString(const char* data, uint64_t size) {
+				write(size);
+				buffer.append(data, size);
+			}
+		};
+
+		/// @brief Deserializes values from a mapped snapshot, throwing if it runs out of bytes.
+		class SnapshotReader {
+		  public:
+			inline SnapshotReader(std::string_view dataNew) : data{ dataNew } {};
+
+			template<typename ValueType>
+				requires(std::is_trivially_copyable_v<ValueType>)
+			inline void read(ValueType& value) {
+				std::memcpy(&value, take(sizeof(value)), sizeof(value));
+			}
+
+			inline void read(Snowflake& value) {
+				uint64_t valueNew{};
+				read(valueNew);
+				value = valueNew;
+			}
+
+			inline void read(UserIdBase& value) {
+				read(value.id);
+			}
+
+			inline void read(TimeStamp& value) {
+				int64_t valueNew{};
+				read(valueNew);
+				value = static_cast<uint64_t>(valueNew);
+			}
+
+			inline void read(Permissions& value) {
+				int64_t valueNew{};
+				read(valueNew);
+				value = valueNew;
+			}
+
+			inline void read(OverWriteData& value) {
+				read(value.type);
+				read(value.allow);
+				read(value.deny);
+				read(value.id);
+			}
+
+			inline void read(std::string& value) {
+				value = readString();
+			}
+
+			inline void read(Jsonifier::String& value) {
+				value = readString();
+			}
+
+			template<typename ValueType> inline void read(Jsonifier::Vector<ValueType>& value) {
+				uint64_t count{ readCount() };
+				value.clear();
+				for (uint64_t x = 0; x < count; ++x) {
+					value.emplace_back();
+					read(value.back());
+				}
+			}
+
+			inline void read(UnorderedSet<Snowflake>& value) {
+				uint64_t count{ readCount() };
+				value.clear();
+				value.reserve(count);
+				for (uint64_t x = 0; x < count; ++x) {
+					Snowflake valueNew{};
+					read(valueNew);
+					value.emplace(valueNew);
+				}
+			}
+
+			template<typename ValueType> inline void readObject(ValueType& value) {
+				std::apply(
+					[&](auto&... fields) {
+						(read(fields), ...);
+					},
+					tieFields(value));
+			}
+
+			/// @brief Reads a section's objects in batches, handing each batch to a function.
+			template<typename ValueType, typename FunctionType> inline void readSection(FunctionType&& function) {
+				uint64_t count{ readCount() };
+				Jsonifier::Vector<ValueType> batch{};
+				while (count > 0) {
+					uint64_t batchSize{ std::min(count, snapshotBatchSize) };
+					batch.clear();
+					for (uint64_t x = 0; x < batchSize; ++x) {
+						batch.emplace_back();
+						readObject(batch.back());
+					}
+					function(batch);
+					count -= batchSize;
+				}
+			}
+
+			/// @brief Reads an element count, rejecting any that the remaining bytes could not possibly hold.
+			inline uint64_t readCount() {
+				uint64_t count{};
+				read(count);
+				if (count > data.size() - offset) {
+					throw DCAException{ "CacheSnapshot::load() Error: The snapshot holds an impossible element count." };
+				}
+				return count;
+			}
+
+		  protected:
+			std::string_view data{};
+			uint64_t offset{};
+
+			inline const char* take(uint64_t size) {
+				if (data.size() - offset < size) {
+					throw DCAException{ "CacheSnapshot::load() Error: The snapshot is truncated." };
+				}
+				const char* current{ data.data() + offset };
+				offset += size;
+				return current;
+			}
+
+			inline std::string readString() {
+				uint64_t size{ readCount() };
+				return std::string{ take(size), size };
+			}
+		};
+
+		/// @brief A read-only view of a whole file, mapped into memory.
+		class MappedFile {
+		  public:
+			inline MappedFile(const std::string& path) {
+#ifdef _WIN32
+				fileHandle = CreateFileA(path.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+				LARGE_INTEGER fileSize{};
+				if (fileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+					return;
+				}
+				mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (!mappingHandle) {
+					return;
+				}
+				auto newData = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+				if (newData) {
+					data = static_cast<const char*>(newData);
+					size = static_cast<uint64_t>(fileSize.QuadPart);
+				}
+#else
+				fileDescriptor = open(path.data(), O_RDONLY);
+				struct stat fileStat {};
+				if (fileDescriptor == -1 || fstat(fileDescriptor, &fileStat) == -1 || fileStat.st_size == 0) {
+					return;
+				}
+				auto newData = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+				if (newData != MAP_FAILED) {
+					madvise(newData, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+					data = static_cast<const char*>(newData);
+					size = static_cast<uint64_t>(fileStat.st_size);
+				}
+#endif
+			}
+
+			inline std::string_view getView() const {
+				return { data, size };
+			}
+
+			inline ~MappedFile() {
+#ifdef _WIN32
+				if (data) {
+					UnmapViewOfFile(data);
+				}
+				if (mappingHandle) {
+					CloseHandle(mappingHandle);
+				}
+				if (fileHandle != INVALID_HANDLE_VALUE) {
+					CloseHandle(fileHandle);
+				}
+#else
+				if (data) {
+					munmap(const_cast<char*>(data), size);
+				}
+				if (fileDescriptor != -1) {
+					close(fileDescriptor);
+				}
+#endif
+			}
+
+		  protected:
+#ifdef _WIN32
+			HANDLE fileHandle{ INVALID_HANDLE_VALUE };
+			HANDLE mappingHandle{};
+#else
+			int32_t fileDescriptor{ -1 };
+#endif
+			const char* data{};
+			uint64_t size{};
+		};
+	}
+
+	void CacheSnapshot::initialize(ConfigManager* configManagerNew) {
+		CacheSnapshot::path = configManagerNew->getSnapshotPath();
+		if (CacheSnapshot::path.empty()) {
+			return;
+		}
+		CacheSnapshot::totalShardCount = configManagerNew->getTotalShardCount();
+		CacheSnapshot::botTokenHash	   = KeyHasher{}(configManagerNew->getBotToken());
+		CacheSnapshot::sequences	   = makeUnique<std::atomic_uint32_t[]>(CacheSnapshot::totalShardCount);
+	}
+
+	bool CacheSnapshot::save() {
+		if (!doWeSnapshot()) {
+			return false;
+		}
+		std::unique_lock saveLock{ CacheSnapshot::saveMutex };
+		DiscordCoreInternal::SnapshotWriter writer{};
+		DiscordCoreInternal::SnapshotHeader header{ DiscordCoreInternal::snapshotMagic, formatVersion, DiscordCoreInternal::getLayoutHash(), CacheSnapshot::botTokenHash,
+			CacheSnapshot::totalShardCount };
+		// The sessions are captured before the caches, and sequences are only recorded once a dispatch has been applied, so the caches are never behind the
+		// sequence that a resume would replay from.
+		{
+			std::unique_lock lock{ CacheSnapshot::sessionMutex };
+			header.sessionCount = static_cast<uint32_t>(CacheSnapshot::sessions.size());
+			writer.write(header);
+			for (auto& [key, value]: CacheSnapshot::sessions) {
+				writer.write(static_cast<uint32_t>(key));
+				writer.write(value.sessionId);
+				writer.write(value.resumeUrl);
+				writer.write(CacheSnapshot::sequences[key].load(std::memory_order_acquire));
+			}
+		}
+		writer.writeSection(Guilds::getCache());
+		writer.writeSection(Channels::getCache());
+		writer.writeSection(Roles::getCache());
+		if (GuildMembers::doWeCompactGuildMembers()) {
+			uint64_t countOffset{ writer.buffer.size() };
+			uint64_t count{};
+			writer.write(count);
+			GuildMembers::getMemberStore().forEach([&](const GuildMemberCacheData& value) {
+				writer.writeObject(value);
+				++count;
+			});
+			std::memcpy(writer.buffer.data() + countOffset, &count, sizeof(count));
+		} else {
+			writer.writeSection(GuildMembers::getCache());
+		}
+		writer.writeSection(Users::getCache());
+
+		std::string temporaryPath{ CacheSnapshot::path + ".tmp" };
+		{
+			std::ofstream file{ temporaryPath, std::ios::binary | std::ios::trunc };
+			file.write(writer.buffer.data(), static_cast<std::streamsize>(writer.buffer.size()));
+			if (!file) {
+				MessagePrinter::printError<PrintMessageType::General>("CacheSnapshot::save() Error: Failed to write to " + temporaryPath + ".");
+				return false;
+			}
+		}
+		std::error_code errorCode{};
+		std::filesystem::rename(temporaryPath, CacheSnapshot::path, errorCode);
+		if (errorCode) {
+			MessagePrinter::printError<PrintMessageType::General>("CacheSnapshot::save() Error: " + errorCode.message());
+			return false;
+		}
+		return true;
+	}
+
+	bool CacheSnapshot::load() {
+		if (!doWeSnapshot()) {
+			return false;
+		}
+		DiscordCoreInternal::MappedFile file{ CacheSnapshot::path };
+		if (file.getView().empty()) {
+			return false;
+		}
+		try {
+			DiscordCoreInternal::SnapshotReader reader{ file.getView() };
+			DiscordCoreInternal::SnapshotHeader header{};
+			reader.read(header);
+			if (header.magic != DiscordCoreInternal::snapshotMagic || header.formatVersion != formatVersion || header.layoutHash != DiscordCoreInternal::getLayoutHash() ||
+				header.botTokenHash != CacheSnapshot::botTokenHash) {
+				MessagePrinter::printError<PrintMessageType::General>("CacheSnapshot::load() Error: Ignoring a snapshot from a different build or bot.");
+				return false;
+			}
+			// The cached objects are still a valid head start under a new shard count, but the sessions are not.
+			bool doWeKeepSessions{ header.totalShardCount == CacheSnapshot::totalShardCount };
+			for (uint32_t x = 0; x < header.sessionCount; ++x) {
+				uint32_t shard{};
+				SnapshotSession session{};
+				reader.read(shard);
+				reader.read(session.sessionId);
+				reader.read(session.resumeUrl);
+				reader.read(session.lastNumberReceived);
+				if (doWeKeepSessions && shard < CacheSnapshot::totalShardCount) {
+					recordSession(shard, session.sessionId, session.resumeUrl);
+					recordSequence(shard, session.lastNumberReceived);
+				}
+			}
+			reader.readSection<GuildCacheData>([](auto& batch) {
+				if (Guilds::doWeCacheGuilds()) {
+					std::unique_lock lock{ CacheSnapshot::sessionMutex };
+					for (auto& value: batch) {
+						CacheSnapshot::loadedGuilds[(value.id.operator const uint64_t&() >> 22) % CacheSnapshot::totalShardCount].emplace_back(value.id);
+					}
+					lock.unlock();
+					Guilds::getCache().insertRange(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+				}
+			});
+			reader.readSection<ChannelCacheData>([](auto& batch) {
+				if (Channels::doWeCacheChannels()) {
+					Channels::getCache().insertRange(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+				}
+			});
+			reader.readSection<RoleCacheData>([](auto& batch) {
+				if (Roles::doWeCacheRoles()) {
+					Roles::getCache().insertRange(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+				}
+			});
+			reader.readSection<GuildMemberCacheData>([](auto& batch) {
+				if (GuildMembers::doWeCacheGuildMembers() && GuildMembers::doWeCompactGuildMembers()) {
+					GuildMembers::getMemberStore().insertRange(batch.begin(), batch.end());
+				} else if (GuildMembers::doWeCacheGuildMembers()) {
+					GuildMembers::getCache().insertRange(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+				}
+			});
+			reader.readSection<UserCacheData>([](auto& batch) {
+				if (Users::doWeCacheUsers()) {
+					Users::getCache().insertRange(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+				}
+			});
+		} catch (const DCAException& error) {
+			MessagePrinter::printError<PrintMessageType::General>(error.what());
+			return false;
+		}
+		return true;
+	}
+
+	void CacheSnapshot::recordSession(uint32_t shard, std::string_view sessionId, std::string_view resumeUrl) {
+		if (!CacheSnapshot::sequences || shard >= CacheSnapshot::totalShardCount) {
+			return;
+		}
+		std::unique_lock lock{ CacheSnapshot::sessionMutex };
+		SnapshotSession& session{ CacheSnapshot::sessions[shard] };
+		session.sessionId = sessionId;
+		session.resumeUrl = resumeUrl;
+	}
+
+	void CacheSnapshot::recordSequence(uint32_t shard, uint32_t sequence) {
+		if (CacheSnapshot::sequences && shard < CacheSnapshot::totalShardCount) {
+			CacheSnapshot::sequences[shard].store(sequence, std::memory_order_release);
+		}
+	}
+
+	void CacheSnapshot::dropSession(uint32_t shard) {
+		if (!CacheSnapshot::sequences || shard >= CacheSnapshot::totalShardCount) {
+			return;
+		}
+		std::unique_lock lock{ CacheSnapshot::sessionMutex };
+		CacheSnapshot::sessions.erase(shard);
+		CacheSnapshot::sequences[shard].store(0, std::memory_order_release);
+		Jsonifier::Vector<Snowflake> guildIds{};
+		if (auto iter = CacheSnapshot::loadedGuilds.find(shard); iter != CacheSnapshot::loadedGuilds.end()) {
+			guildIds = std::move(iter->second);
+			CacheSnapshot::loadedGuilds.erase(shard);
+		}
+		lock.unlock();
+		for (auto& value: guildIds) {
+			GuildCacheData guild{};
+			if (!Guilds::getCache().visit(value, [&](const GuildCacheData& valueNew) {
+					guild = valueNew;
+				})) {
+				continue;
+			}
+			for (auto& valueNew: guild.channels) {
+				Channels::getCache().erase(valueNew);
+			}
+			for (auto& valueNew: guild.roles) {
+				Roles::getCache().erase(valueNew);
+			}
+			for (auto& valueNew: guild.members) {
+				TwoIdKey key{};
+				key.idOne = guild.id;
+				key.idTwo = valueNew;
+				GuildMembers::removeGuildMember(key);
+			}
+			Guilds::getCache().erase(value);
+			PermissionEvaluator::invalidateGuild(value);
+		}
+	}
+
+	void CacheSnapshot::confirmSession(uint32_t shard) {
+		std::unique_lock lock{ CacheSnapshot::sessionMutex };
+		CacheSnapshot::loadedGuilds.erase(shard);
+	}
+
+	bool CacheSnapshot::getSession(uint32_t shard, SnapshotSession& session) {
+		if (!CacheSnapshot::sequences || shard >= CacheSnapshot::totalShardCount) {
+			return false;
+		}
+		std::unique_lock lock{ CacheSnapshot::sessionMutex };
+		auto iter = CacheSnapshot::sessions.find(shard);
+		if (iter == CacheSnapshot::sessions.end() || iter->second.sessionId.empty() || iter->second.resumeUrl.empty()) {
+			return false;
+		}
+		session					   = iter->second;
+		session.lastNumberReceived = CacheSnapshot::sequences[shard].load(std::memory_order_acquire);
+		return true;
+	}
+
+	bool CacheSnapshot::doWeSnapshot() {
+		return !CacheSnapshot::path.empty();
+	}
+
+	UnorderedMap<uint64_t, Jsonifier::Vector<Snowflake>> CacheSnapshot::loadedGuilds{};
+	UnorderedMap<uint64_t, SnapshotSession> CacheSnapshot::sessions{};
+	UniquePtr<std::atomic_uint32_t[]> CacheSnapshot::sequences{};
+	std::mutex CacheSnapshot::sessionMutex{};
+	std::mutex CacheSnapshot::saveMutex{};
+	uint32_t CacheSnapshot::totalShardCount{};
+	uint64_t CacheSnapshot::botTokenHash{};
+	std::string CacheSnapshot::path{};
+}
@@ -218,6 +218,8 @@ namespace DiscordCoreAPI {
 
 	void Channels::initialize(DiscordCoreInternal::HttpsClient* client, ConfigManager* configManagerNew) {
 		Channels::doWeCacheChannelsBool = configManagerNew->doWeCacheChannels();
+		Channels::fetchCoalescer.setNegativeTtl(configManagerNew->getNegativeCacheTtl());
+		Channels::cache.setLimits(configManagerNew->getCacheOptions().channelLimits);
 		Channels::httpsClient			= client;
 	}
 
@@ -228,9 +230,9 @@ namespace DiscordCoreAPI {
 		workload.relativePath  = "/channels/" + dataPackage.channelId;
 		workload.callStack	   = "Channels::getChannelAsync()";
 		ChannelData data{ dataPackage.channelId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
+		cache.visit(data.id, [&](const ChannelCacheData& value) {
+			data = value;
+		});
 		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheChannelsBool) {
 			insertChannel(static_cast<ChannelCacheData>(data));
@@ -239,12 +241,15 @@ namespace DiscordCoreAPI {
 	}
 
 	ChannelCacheData Channels::getCachedChannel(GetChannelData dataPackage) {
-		ChannelData data{ dataPackage.channelId };
-		if (!Channels::cache.contains(data.id)) {
-			return Channels::getChannelAsync(dataPackage).get();
-		} else {
-			return cache[data.id];
+		ChannelCacheData data{};
+		if (cache.visit(dataPackage.channelId, [&](const ChannelCacheData& value) {
+				data = value;
+			})) {
+			return data;
 		}
+		return fetchCoalescer.run(dataPackage.channelId, [&]() -> ChannelCacheData {
+			return Channels::getChannelAsync(dataPackage).get();
+		});
 	}
 
 	CoRoutine<ChannelData> Channels::modifyChannelAsync(ModifyChannelData dataPackage) {
@@ -258,9 +263,9 @@ namespace DiscordCoreAPI {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		ChannelData data{ dataPackage.channelId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
+		cache.visit(data.id, [&](const ChannelCacheData& value) {
+			data = value;
+		});
 		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheChannelsBool) {
 			insertChannel(static_cast<ChannelCacheData>(data));
@@ -439,6 +444,7 @@ namespace DiscordCoreAPI {
 		return Channels::doWeCacheChannelsBool;
 	}
 
+	RequestCoalescer<Snowflake, ChannelCacheData> Channels::fetchCoalescer{};
 	ObjectCache<ChannelCacheData> Channels::cache{};
 	DiscordCoreInternal::HttpsClient* Channels::httpsClient{};
 	bool Channels::doWeCacheChannelsBool{};
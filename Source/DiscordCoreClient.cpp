@@ -37,6 +37,7 @@
 namespace DiscordCoreAPI {
 
 	VoiceConnectionsMap voiceConnectionMap{};
+	VoiceSendScheduler voiceSendScheduler{};
 	SoundCloudAPIMap soundCloudAPIMap{};
 	YouTubeAPIMap youtubeAPIMap{};
 	SongAPIMap songAPIMap{};
@@ -61,7 +62,7 @@ namespace DiscordCoreAPI {
 			uint64_t theShardId{ (guildId.operator const uint64_t&() >> 22) % getInstance()->configManager.getTotalShardCount() };
 			uint64_t baseSocketIndex{ theShardId % getInstance()->baseSocketAgentsMap.size() };
 			auto baseSocketAgent								   = getInstance()->baseSocketAgentsMap[baseSocketIndex].get();
-			voiceConnectionMap[guildId.operator const uint64_t&()] = makeUnique<VoiceConnection>(getInstance(), &baseSocketAgent->shardMap[theShardId], &doWeQuit);
+			voiceConnectionMap[guildId.operator const uint64_t&()] = makeUnique<VoiceConnection>(getInstance(), &baseSocketAgent->getClient(static_cast<uint32_t>(theShardId)), &doWeQuit);
 		}
 		return *voiceConnectionMap[guildId.operator const uint64_t&()].get();
 	}
@@ -132,7 +133,8 @@ namespace DiscordCoreAPI {
 			MessagePrinter::printError<PrintMessageType::General>("LibSodium failed to initialize!");
 			return;
 		}
-		httpsClient = makeUnique<DiscordCoreInternal::HttpsClient>(configManager.getBotToken());
+		httpsClient = makeUnique<DiscordCoreInternal::HttpsClient>(configManager.getBotToken(), configManager.getHttpsOptions());
+		ObjectCacheBudget::setBudget(configManager.getCacheOptions().memoryBudgetInBytes);
 		ApplicationCommands::initialize(httpsClient.get());
 		AutoModerationRules::initialize(httpsClient.get());
 		Channels::initialize(httpsClient.get(), &configManager);
@@ -143,11 +145,16 @@ namespace DiscordCoreAPI {
 		Messages::initialize(httpsClient.get());
 		Reactions::initialize(httpsClient.get());
 		Roles::initialize(httpsClient.get(), &configManager);
+		PermissionEvaluator::initialize(&configManager);
 		Stickers::initialize(httpsClient.get());
 		StageInstances::initialize(httpsClient.get());
 		Threads::initialize(httpsClient.get());
 		WebHooks::initialize(httpsClient.get());
 		Users::initialize(httpsClient.get(), &configManager);
+		CacheSnapshot::initialize(&configManager);
+		if (CacheSnapshot::load()) {
+			MessagePrinter::printSuccess<PrintMessageType::General>("Loaded the cache snapshot from " + configManager.getSnapshotPath() + ".");
+		}
 	}
 
 	ConfigManager& DiscordCoreClient::getConfigManager() {
@@ -286,7 +293,15 @@ namespace DiscordCoreAPI {
 			if (!baseSocketAgentsMap.contains(x % theWorkerCount)) {
 				baseSocketAgentsMap[x % theWorkerCount] = makeUnique<DiscordCoreInternal::BaseSocketAgent>(this, &doWeQuit, x % theWorkerCount);
 			}
-			baseSocketAgentsMap[x % theWorkerCount]->shardMap[x] = DiscordCoreInternal::WebSocketClient{ this, x, &doWeQuit };
+			auto client{ makeUnique<DiscordCoreInternal::WebSocketClient>(this, x, &doWeQuit) };
+			SnapshotSession session{};
+			if (CacheSnapshot::getSession(x, session)) {
+				client->lastNumberReceived = session.lastNumberReceived;
+				client->sessionId		   = std::move(session.sessionId);
+				client->resumeUrl		   = std::move(session.resumeUrl);
+				client->areWeResuming	   = true;
+			}
+			baseSocketAgentsMap[x % theWorkerCount]->addClient(x, std::move(client));
 			while (!connectionStopWatch01.hasTimePassed()) {
 				std::this_thread::sleep_for(1ms);
 			}
@@ -295,23 +310,25 @@ namespace DiscordCoreAPI {
 		for (auto& value: configManager.getFunctionsToExecute()) {
 			executeFunctionAfterTimePeriod(value.function, value.intervalInMs, value.repeated, false, this);
 		}
+		if (CacheSnapshot::doWeSnapshot() && configManager.getSnapshotInterval().count() > 0) {
+			TimeElapsedHandler<> saveSnapshot{ [] {
+				CacheSnapshot::save();
+			} };
+			executeFunctionAfterTimePeriod(saveSnapshot, configManager.getSnapshotInterval().count(), true, false);
+		}
 		startupTimeSinceEpoch = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch());
 		return true;
 	}
 
 	DiscordCoreClient::~DiscordCoreClient() {
+		CacheSnapshot::save();
 		auto guildVector = Guilds::getAllGuildsAsync();
 		for (auto& value: guildVector) {
 			if (value.areWeConnected()) {
 				value.disconnect();
 			}
 		}
-		for (auto& [key, value]: NewThreadAwaiterBase::threadPool.workerThreads) {
-			if (value->thread.joinable()) {
-				value->thread.requestStop();
-				value->thread.detach();
-			}
-		}
+		NewThreadAwaiterBase::threadPool.requestStop();
 		instancePtr.release();
 	}
 
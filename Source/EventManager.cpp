@@ -184,85 +184,87 @@ namespace DiscordCoreAPI {
 	template<> UnorderedMap<std::string, UnboundedMessageBlock<ReactionData>*> ObjectCollector<ReactionData>::objectsBuffersMap;
 
 	OnInputEventCreationData::OnInputEventCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnApplicationCommandPermissionsUpdateData::OnApplicationCommandPermissionsUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnAutoModerationRuleCreationData::OnAutoModerationRuleCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnAutoModerationRuleUpdateData::OnAutoModerationRuleUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnAutoModerationRuleDeletionData::OnAutoModerationRuleDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnAutoModerationActionExecutionData::OnAutoModerationActionExecutionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnChannelCreationData::OnChannelCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		if (Channels::doWeCacheChannels()) {
-			if (Guilds::getCache().contains(value.guildId)) {
-				Guilds::getCache()[value.guildId].channels.emplace(value.id);
-			}
+			Guilds::getCache().update(value.guildId, [&](GuildCacheData& guild) {
+				guild.channels.emplace(value.id);
+			});
 			Channels::insertChannel(static_cast<ChannelCacheData>(value));
 		}
 	}
 
 	OnChannelUpdateData::OnChannelUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<UpdatedEventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		oldValue = Channels::getCachedChannel({ .channelId = value.id });
 		if (Channels::doWeCacheChannels()) {
 			Channels::insertChannel(static_cast<ChannelCacheData>(value));
 		}
+		PermissionEvaluator::invalidateChannel(value.guildId, value.id);
 	}
 
 	OnChannelDeletionData::OnChannelDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		if (Channels::doWeCacheChannels()) {
-			if (Guilds::getCache().contains(value.guildId)) {
-				if (Guilds::getCache().operator[](value.guildId).channels.contains(value.id)) {
-					Guilds::getCache().operator[](value.guildId).channels.erase(value.id);
+			Guilds::getCache().update(value.guildId, [&](GuildCacheData& guild) {
+				if (guild.channels.contains(value.id)) {
+					guild.channels.erase(value.id);
 				}
-			}
+			});
 			Channels::removeChannel(static_cast<ChannelCacheData>(value));
 		}
+		PermissionEvaluator::invalidateChannel(value.guildId, value.id);
 	}
 
 	OnChannelPinsUpdateData::OnChannelPinsUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnThreadCreationData::OnThreadCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnThreadUpdateData::OnThreadUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnThreadDeletionData::OnThreadDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnThreadListSyncData::OnThreadListSyncData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnThreadMemberUpdateData::OnThreadMemberUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnThreadMembersUpdateData::OnThreadMembersUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	template<JsonifierInternal::TimeT TimeType> class StopWatchNew {
@@ -331,27 +333,36 @@ namespace DiscordCoreAPI {
 
 	inline StopWatchNew<Milliseconds> stopWatch{};
 
+	/// @brief Bulk-inserts a GUILD_CREATE member, channel or role list into its cache.
+	/// @details The elements are moved in when nobody is listening for the event, and copied otherwise - so that handlers still see the full payload. Their
+	/// ids are left intact either way, for the guild's own cache entry.
+	template<typename ValueType, typename RangeType, typename ProjectionType = std::identity>
+	inline void insertRangeIntoCache(ObjectCache<ValueType>& cache, RangeType& range, bool doWeMove, ProjectionType projection = {}) {
+		if (doWeMove) {
+			cache.insertRange(std::make_move_iterator(range.begin()), std::make_move_iterator(range.end()), projection);
+		} else {
+			cache.insertRange(range.begin(), range.end(), projection);
+		}
+	}
+
 	OnGuildCreationData::OnGuildCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreClient* client) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		value.discordCoreClient = client;
+		bool doWeMove{ client->getEventManager().onGuildCreationEvent.functions.size() == 0 };
 		if (GuildMembers::doWeCacheGuildMembers() || Users::doWeCacheUsers()) {
-			if (GuildMembers::doWeCacheGuildMembers()) {
-				GuildMembers::getCache().reserve(GuildMembers::getCache().size() + value.members.size());
-			}
 			if (Users::doWeCacheUsers()) {
-				Users::getCache().reserve(GuildMembers::getCache().size() + value.members.size());
+				insertRangeIntoCache(Users::getCache(), value.members, doWeMove, [](auto&& member) -> decltype(auto) {
+					return (std::forward<decltype(member)>(member).user);
+				});
 			}
-			for (auto& valueNew: value.members) {
-				try {
-					if (Users::doWeCacheUsers()) {
-						Users::insertUser(static_cast<UserCacheData>(valueNew.user));
-					}
-					if (GuildMembers::doWeCacheGuildMembers()) {
-						valueNew.guildId = value.id;
-						GuildMembers::insertGuildMember(static_cast<GuildMemberCacheData>(valueNew));
-					}					
-				} catch (...) {
-					MessagePrinter::printError<PrintMessageType::General>("OnGuildCreationData::OnGuildCreationData()");
+			if (GuildMembers::doWeCacheGuildMembers()) {
+				for (auto& valueNew: value.members) {
+					valueNew.guildId = value.id;
+				}
+				if (GuildMembers::doWeCompactGuildMembers()) {
+					GuildMembers::getMemberStore().insertRange(value.members.begin(), value.members.end());
+				} else {
+					insertRangeIntoCache(GuildMembers::getCache(), value.members, doWeMove);
 				}
 			}
 			for (auto& valueNew: value.voiceStates) {
@@ -364,25 +375,13 @@ namespace DiscordCoreAPI {
 			}
 		}
 		if (Channels::doWeCacheChannels()) {
-			Channels::getCache().reserve(GuildMembers::getCache().size() + value.channels.size());
 			for (auto& valueNew: value.channels) {
-				try {
-					valueNew.guildId = value.id;
-					Channels::insertChannel(static_cast<ChannelCacheData>(valueNew));
-				} catch (...) {
-					MessagePrinter::printError<PrintMessageType::General>("OnGuildCreationData::OnGuildCreationData()");
-				}
+				valueNew.guildId = value.id;
 			}
+			insertRangeIntoCache(Channels::getCache(), value.channels, doWeMove);
 		}
 		if (Roles::doWeCacheRoles()) {
-			Roles::getCache().reserve(GuildMembers::getCache().size() + value.roles.size());
-			for (auto& valueNew: value.roles) {
-				try {
-					Roles::insertRole(static_cast<RoleCacheData>(valueNew));
-				} catch (...) {
-					MessagePrinter::printError<PrintMessageType::General>("OnGuildCreationData::OnGuildCreationData()");
-				}
-			}
+			insertRangeIntoCache(Roles::getCache(), value.roles, doWeMove);
 		}
 		if (Guilds::doWeCacheGuilds()) {
 			value.discordCoreClient = client;
@@ -394,15 +393,16 @@ namespace DiscordCoreAPI {
 	}
 
 	OnGuildUpdateData::OnGuildUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreClient* clientNew) {
-		parserNew.parseJson<true, true>(*static_cast<UpdatedEventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		value.discordCoreClient = clientNew;
 		if (Guilds::doWeCacheGuilds()) {
 			Guilds::insertGuild(static_cast<GuildCacheData>(value));
 		}
+		PermissionEvaluator::invalidateGuild(value.id);
 	}
 
 	OnGuildDeletionData::OnGuildDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		for (auto& valueNew: value.members) {
 			GuildMembers::removeGuildMember(valueNew);
 		}
@@ -415,108 +415,114 @@ namespace DiscordCoreAPI {
 		if (Guilds::doWeCacheGuilds()) {
 			Guilds::removeGuild(value);
 		}
+		PermissionEvaluator::invalidateGuild(value.id);
 	}
 
 	OnGuildBanAddData::OnGuildBanAddData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
-		if (Guilds::getCache().contains(value.guildId)) {
-			if (Guilds::getCache().operator[](value.guildId).members.contains(value.user.id)) {
-				Guilds::getCache().operator[](value.guildId).members.erase(value.user.id);
-				--Guilds::getCache()[value.guildId].memberCount;
+		parserNew.parseJson<true, true>(value, dataToParse);
+		Guilds::getCache().update(value.guildId, [&](GuildCacheData& guild) {
+			if (guild.members.contains(value.user.id)) {
+				guild.members.erase(value.user.id);
+				--guild.memberCount;
 			}
-		}
+		});
 	}
 
 	OnGuildBanRemoveData::OnGuildBanRemoveData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnGuildEmojisUpdateData::OnGuildEmojisUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
-		if (Guilds::getCache().contains(value.guildId)) {
-			Guilds::getCache()[value.guildId].emoji.clear();
+		parserNew.parseJson<true, true>(value, dataToParse);
+		Guilds::getCache().update(value.guildId, [&](GuildCacheData& guild) {
+			guild.emoji.clear();
 			for (auto& valueNew: value.emojis) {
-				Guilds::getCache()[value.guildId].emoji.emplace(valueNew.id);
+				guild.emoji.emplace(valueNew.id);
 			}
-		}
+		});
 	}
 
 	OnGuildStickersUpdateData::OnGuildStickersUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnGuildIntegrationsUpdateData::OnGuildIntegrationsUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnGuildMemberAddData::OnGuildMemberAddData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		if (GuildMembers::doWeCacheGuildMembers()) {
 			GuildMembers::insertGuildMember(static_cast<GuildMemberCacheData>(value));
-			if (Guilds::getCache().contains(value.guildId)) {
-				++Guilds::getCache()[value.guildId].memberCount;
-			}
+			Guilds::getCache().update(value.guildId, [](GuildCacheData& guild) {
+				++guild.memberCount;
+			});
 		}
 	}
 
 	OnGuildMemberRemoveData::OnGuildMemberRemoveData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		GuildMemberData guildMember = GuildMembers::getCachedGuildMember({ .guildMemberId = value.user.id, .guildId = value.guildId });
 		if (GuildMembers::doWeCacheGuildMembers()) {
-			if (Guilds::getCache().contains(value.guildId)) {
-				if (Guilds::getCache().operator[](value.guildId).members.contains(value.user.id)) {
-					Guilds::getCache().operator[](value.guildId).members.erase(value.user.id);
-					--Guilds::getCache()[value.guildId].memberCount;
+			Guilds::getCache().update(value.guildId, [&](GuildCacheData& guild) {
+				if (guild.members.contains(value.user.id)) {
+					guild.members.erase(value.user.id);
+					--guild.memberCount;
 				}
-			}
+			});
 			GuildMembers::removeGuildMember(guildMember);
 		}
+		PermissionEvaluator::invalidateMember(value.guildId, value.user.id);
 	}
 
 	OnGuildMemberUpdateData::OnGuildMemberUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<UpdatedEventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		oldValue = GuildMembers::getCachedGuildMember({ .guildMemberId = value.user.id, .guildId = value.guildId });
 		if (GuildMembers::doWeCacheGuildMembers()) {
 			GuildMembers::insertGuildMember(static_cast<GuildMemberCacheData>(value));
 		}
+		PermissionEvaluator::invalidateMember(value.guildId, value.user.id);
 	}
 
 	OnGuildMembersChunkData::OnGuildMembersChunkData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnRoleCreationData::OnRoleCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		if (Roles::doWeCacheRoles()) {
-			if (Guilds::getCache().contains(value.guildId)) {
+			if (Guilds::getCache().update(value.guildId, [&](GuildCacheData& guild) {
+					guild.roles.emplace(value.role.id);
+				})) {
 				Roles::insertRole(static_cast<RoleCacheData>(value.role));
-				Guilds::getCache()[value.guildId].roles.emplace(value.role.id);
 			}
 		}
 	}
 
 	OnRoleUpdateData::OnRoleUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<UpdatedEventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		oldValue = Roles::getCachedRole({ .guildId = value.guildId, .roleId = value.role.id });
 		if (Roles::doWeCacheRoles()) {
 			Roles::insertRole(static_cast<RoleCacheData>(value.role));
 		}
+		PermissionEvaluator::invalidateGuild(value.guildId);
 	}
 
 	OnRoleDeletionData::OnRoleDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		if (Roles::doWeCacheRoles()) {
-			if (Guilds::getCache().contains(value.guildId)) {
-				if (Guilds::getCache().operator[](value.guildId).channels.contains(value.role.id)) {
-					Guilds::getCache().operator[](value.guildId).channels.erase(value.role.id);
+			Guilds::getCache().update(value.guildId, [&](GuildCacheData& guild) {
+				if (guild.roles.contains(value.role.id)) {
+					guild.roles.erase(value.role.id);
 				}
-			}
+			});
 			Roles::removeRole(static_cast<RoleCacheData>(value.role));
 		}
+		PermissionEvaluator::invalidateGuild(value.guildId);
 	}
 
 	OnVoiceServerUpdateData::OnVoiceServerUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreInternal::WebSocketClient* sslShard) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		if (sslShard->areWeCollectingData.load(std::memory_order_acquire) && !sslShard->serverUpdateCollected && !sslShard->stateUpdateCollected) {
 			sslShard->voiceConnectionData		   = DiscordCoreInternal::VoiceConnectionData{};
 			sslShard->voiceConnectionData.endPoint = value.endpoint;
@@ -535,39 +541,39 @@ namespace DiscordCoreAPI {
 	};
 
 	OnGuildScheduledEventCreationData::OnGuildScheduledEventCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnGuildScheduledEventUpdateData::OnGuildScheduledEventUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnGuildScheduledEventDeletionData::OnGuildScheduledEventDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnGuildScheduledEventUserAddData::OnGuildScheduledEventUserAddData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnGuildScheduledEventUserRemoveData::OnGuildScheduledEventUserRemoveData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnIntegrationCreationData::OnIntegrationCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnIntegrationUpdateData::OnIntegrationUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnIntegrationDeletionData::OnIntegrationDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnInteractionCreationData::OnInteractionCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreClient* discordCoreClient) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		UniquePtr<InputEventData> eventData{ makeUnique<InputEventData>(value) };
 		switch (value.type) {
 			case InteractionType::Application_Command: {
@@ -636,76 +642,76 @@ namespace DiscordCoreAPI {
 	}
 
 	OnInviteCreationData::OnInviteCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnInviteDeletionData::OnInviteDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnMessageCreationData::OnMessageCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		for (auto& [key, valueNew]: MessageCollector::objectsBuffersMap) {
 			valueNew->send(value);
 		}
 	}
 
 	OnMessageUpdateData::OnMessageUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		for (auto& [key, valueNew]: MessageCollector::objectsBuffersMap) {
 			valueNew->send(value);
 		}
 	}
 
 	OnMessageDeletionData::OnMessageDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnMessageDeleteBulkData::OnMessageDeleteBulkData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnReactionAddData::OnReactionAddData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		for (auto& [key, valueNew]: ReactionCollector::objectsBuffersMap) {
 			valueNew->send(value);
 		}
 	}
 
 	OnReactionRemoveData::OnReactionRemoveData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnReactionRemoveAllData::OnReactionRemoveAllData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnReactionRemoveEmojiData::OnReactionRemoveEmojiData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnPresenceUpdateData::OnPresenceUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnStageInstanceCreationData::OnStageInstanceCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnStageInstanceUpdateData::OnStageInstanceUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnStageInstanceDeletionData::OnStageInstanceDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnTypingStartData::OnTypingStartData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnUserUpdateData::OnUserUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<UpdatedEventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		oldValue = Users::getCachedUser({ value.id });
 		if (Users::doWeCacheUsers()) {
 			Users::insertUser(static_cast<UserCacheData>(value));
@@ -713,7 +719,7 @@ namespace DiscordCoreAPI {
 	}
 
 	OnVoiceStateUpdateData::OnVoiceStateUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreInternal::WebSocketClient* sslShard) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 		if (sslShard->areWeCollectingData.load(std::memory_order_acquire) && !sslShard->stateUpdateCollected && !sslShard->serverUpdateCollected &&
 			value.userId == sslShard->userId) {
 			sslShard->voiceConnectionData			= DiscordCoreInternal::VoiceConnectionData{};
@@ -736,11 +742,11 @@ namespace DiscordCoreAPI {
 	}
 
 	OnWebhookUpdateData::OnWebhookUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	OnAutoCompleteEntryData::OnAutoCompleteEntryData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
-		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		parserNew.parseJson<true, true>(value, dataToParse);
 	}
 
 	DiscordCoreInternal::EventDelegateToken EventManager::onApplicationCommandsPermissionsUpdate(
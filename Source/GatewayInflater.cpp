@@ -0,0 +1,141 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++
+   CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GatewayInflater.cpp - Source file for the GatewayInflater class.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file GatewayInflater.cpp
+
+#include <discordcoreapi/Utilities/GatewayInflater.hpp>
+
+#if defined(DiscordCoreAPI_ZLIB)
+	#include <zlib.h>
+#else
+struct z_stream_s {};
+#endif
+
+namespace DiscordCoreAPI {
+
+	namespace DiscordCoreInternal {
+
+		constexpr std::string_view zlibFlushSuffix{ "\x00\x00\xff\xff", 4 };
+		constexpr uint64_t minimumOutputSpace{ 1024 * 16 };
+
+		GatewayInflater::GatewayInflater() noexcept = default;
+
+		GatewayInflater& GatewayInflater::operator=(GatewayInflater&& other) noexcept {
+			if (this != &other) {
+#if defined(DiscordCoreAPI_ZLIB)
+				if (stream) {
+					inflateEnd(stream.get());
+				}
+#endif
+				stream		  = std::move(other.stream);
+				pendingBuffer = std::move(other.pendingBuffer);
+				outputBuffer  = std::move(other.outputBuffer);
+			}
+			return *this;
+		}
+
+		GatewayInflater::GatewayInflater(GatewayInflater&& other) noexcept {
+			*this = std::move(other);
+		}
+
+		bool GatewayInflater::isItSupported() {
+#if defined(DiscordCoreAPI_ZLIB)
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		void GatewayInflater::reset() {
+			pendingBuffer.clear();
+#if defined(DiscordCoreAPI_ZLIB)
+			if (!stream) {
+				stream = makeUnique<z_stream_s>();
+				if (inflateInit(stream.get()) != Z_OK) {
+					stream.reset();
+					throw DCAException{ "GatewayInflater::reset() Error: Failed to initialize the inflate context." };
+				}
+			} else {
+				inflateReset(stream.get());
+			}
+#endif
+		}
+
+		bool GatewayInflater::inflate(std::string_view data, std::string_view& outData) {
+#if defined(DiscordCoreAPI_ZLIB)
+			if (!stream) {
+				reset();
+			}
+			// A payload is only whole once it ends in the sync-flush marker; until then its pieces are held back.
+			if (data.size() < zlibFlushSuffix.size() || data.substr(data.size() - zlibFlushSuffix.size()) != zlibFlushSuffix) {
+				pendingBuffer.append(data);
+				return false;
+			}
+			if (pendingBuffer.size() > 0) {
+				pendingBuffer.append(data);
+				data = pendingBuffer;
+			}
+			stream->next_in	 = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+			stream->avail_in = static_cast<uInt>(data.size());
+			uint64_t outputSize{};
+			do {
+				if (outputBuffer.size() - outputSize < minimumOutputSpace) {
+					outputBuffer.resize(std::max<uint64_t>(outputBuffer.size() * 2, outputSize + minimumOutputSpace));
+				}
+				stream->next_out  = reinterpret_cast<Bytef*>(outputBuffer.data() + outputSize);
+				stream->avail_out = static_cast<uInt>(outputBuffer.size() - outputSize);
+				int32_t result{ ::inflate(stream.get(), Z_SYNC_FLUSH) };
+				outputSize = outputBuffer.size() - stream->avail_out;
+				if (result != Z_OK && result != Z_BUF_ERROR) {
+					std::string errorMessage{ stream->msg ? stream->msg : "Failed to inflate the payload." };
+					reset();
+					throw DCAException{ "GatewayInflater::inflate() Error: " + errorMessage };
+				}
+				if (result == Z_BUF_ERROR && stream->avail_out != 0) {
+					break;
+				}
+			} while (stream->avail_in > 0 || stream->avail_out == 0);
+			pendingBuffer.clear();
+			outData = std::string_view{ outputBuffer.data(), outputSize };
+			return true;
+#else
+			outData = data;
+			throw DCAException{ "GatewayInflater::inflate() Error: The library was built without zlib." };
+#endif
+		}
+
+		GatewayInflater::~GatewayInflater() noexcept {
+#if defined(DiscordCoreAPI_ZLIB)
+			if (stream) {
+				inflateEnd(stream.get());
+			}
+#endif
+		}
+	}
+}
@@ -289,6 +289,8 @@ namespace DiscordCoreAPI {
 
 	void Guilds::initialize(DiscordCoreInternal::HttpsClient* client, DiscordCoreClient* discordCoreClientNew, ConfigManager* configManagerNew) {
 		Guilds::doWeCacheGuildsBool = configManagerNew->doWeCacheGuilds();
+		Guilds::fetchCoalescer.setNegativeTtl(configManagerNew->getNegativeCacheTtl());
+		Guilds::cache.setLimits(configManagerNew->getCacheOptions().guildLimits);
 		Guilds::discordCoreClient	= discordCoreClientNew;
 		Guilds::httpsClient			= client;
 	}
@@ -361,9 +363,9 @@ namespace DiscordCoreAPI {
 		workload.callStack	   = "Guilds::getGuildAsync()";
 		GuildData data{ dataPackage.guildId };
 		data.discordCoreClient = Guilds::discordCoreClient;
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
+		cache.visit(data.id, [&](const GuildCacheData& value) {
+			data = value;
+		});
 		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheGuildsBool) {
 			insertGuild(static_cast<GuildCacheData>(data));
@@ -373,14 +375,16 @@ namespace DiscordCoreAPI {
 
 	GuildCacheData Guilds::getCachedGuild(GetGuildData dataPackage) {
 		GuildCacheData data{};
-		data.id = dataPackage.guildId;
-		if (!Guilds::cache.contains(data.id)) {
+		if (cache.visit(dataPackage.guildId, [&](const GuildCacheData& value) {
+				data = value;
+			})) {
+			return data;
+		}
+		return fetchCoalescer.run(dataPackage.guildId, [&]() -> GuildCacheData {
 			auto guild				= Guilds::getGuildAsync({ .guildId = dataPackage.guildId }).get();
 			guild.discordCoreClient = Guilds::discordCoreClient;
 			return guild;
-		} else {
-			return cache[dataPackage.guildId];
-		}
+		});
 	}
 
 	CoRoutine<GuildPreviewData> Guilds::getGuildPreviewAsync(GetGuildPreviewData dataPackage) {
@@ -406,9 +410,9 @@ namespace DiscordCoreAPI {
 		}
 		GuildData data{ dataPackage.guildId };
 		data.discordCoreClient = Guilds::discordCoreClient;
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
+		cache.visit(data.id, [&](const GuildCacheData& value) {
+			data = value;
+		});
 		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheGuildsBool) {
 			insertGuild(static_cast<GuildCacheData>(data));
@@ -873,6 +877,7 @@ namespace DiscordCoreAPI {
 	}
 
 	DiscordCoreInternal::HttpsClient* Guilds::httpsClient{};
+	RequestCoalescer<Snowflake, GuildCacheData> Guilds::fetchCoalescer{};
 	ObjectCache<GuildCacheData> Guilds::cache{};
 	DiscordCoreClient* Guilds::discordCoreClient{};
 	bool Guilds::doWeCacheGuildsBool{};
@@ -143,8 +143,270 @@ namespace DiscordCoreAPI {
 		*this = std::move(other);
 	}
 
+	void GuildMemberStore::insert(const GuildMemberCacheData& guildMember) {
+		GuildColumns& columns{ getColumns(guildMember.guildId) };
+		std::unique_lock lock{ columns.columnMutex };
+		insertInternal(columns, guildMember);
+	}
+
+	bool GuildMemberStore::find(const TwoIdKey& key, GuildMemberCacheData& guildMember) {
+		GuildColumns* columns{ findColumns(key.idOne) };
+		if (!columns) {
+			return false;
+		}
+		std::shared_lock lock{ columns->columnMutex };
+		auto iter = columns->rowIndices.find(key.idTwo.operator const uint64_t&());
+		if (iter == columns->rowIndices.end()) {
+			return false;
+		}
+		fillMember(*columns, iter->second, key.idOne, guildMember);
+		return true;
+	}
+
+	bool GuildMemberStore::contains(const TwoIdKey& key) {
+		GuildColumns* columns{ findColumns(key.idOne) };
+		if (!columns) {
+			return false;
+		}
+		std::shared_lock lock{ columns->columnMutex };
+		return columns->rowIndices.contains(key.idTwo.operator const uint64_t&());
+	}
+
+	void GuildMemberStore::erase(const TwoIdKey& key) {
+		GuildColumns* columns{ findColumns(key.idOne) };
+		if (!columns) {
+			return;
+		}
+		std::unique_lock lock{ columns->columnMutex };
+		auto iter = columns->rowIndices.find(key.idTwo.operator const uint64_t&());
+		if (iter == columns->rowIndices.end()) {
+			return;
+		}
+		uint32_t row{ iter->second };
+		uint32_t lastRow{ static_cast<uint32_t>(columns->userIds.size() - 1) };
+		columns->rowIndices.erase(key.idTwo.operator const uint64_t&());
+		columns->deadNickBytes += columns->nicks[row].length;
+		releaseRoleSet(*columns, columns->roleSetRows[row]);
+		if (row != lastRow) {
+			columns->roleSetRows[row]					 = columns->roleSetRows[lastRow];
+			columns->permissions[row]					 = columns->permissions[lastRow];
+			columns->joinedAts[row]						 = columns->joinedAts[lastRow];
+			columns->userIds[row]						 = columns->userIds[lastRow];
+			columns->avatars[row]						 = columns->avatars[lastRow];
+			columns->flags[row]							 = columns->flags[lastRow];
+			columns->nicks[row]							 = columns->nicks[lastRow];
+			columns->rowIndices[columns->userIds[row]] = row;
+		}
+		columns->roleSetRows.resize(lastRow);
+		columns->permissions.resize(lastRow);
+		columns->joinedAts.resize(lastRow);
+		columns->userIds.resize(lastRow);
+		columns->avatars.resize(lastRow);
+		columns->flags.resize(lastRow);
+		columns->nicks.resize(lastRow);
+		reclaimArenas(*columns);
+	}
+
+	uint64_t GuildMemberStore::size() {
+		std::shared_lock lock{ guildMutex };
+		uint64_t sizeNew{};
+		for (auto& [key, value]: guilds) {
+			std::shared_lock columnLock{ value->columnMutex };
+			sizeNew += value->userIds.size();
+		}
+		return sizeNew;
+	}
+
+	uint64_t GuildMemberStore::getMemoryUsage() {
+		std::shared_lock lock{ guildMutex };
+		uint64_t bytes{ guilds.capacity() * (sizeof(Pair<uint64_t, UniquePtr<GuildColumns>>) + 1) };
+		for (auto& [key, value]: guilds) {
+			std::shared_lock columnLock{ value->columnMutex };
+			uint64_t rowCount{ value->userIds.size() };
+			bytes += sizeof(GuildColumns) + value->nickArena.capacity();
+			bytes += rowCount * (sizeof(GuildMemberFlags) + sizeof(uint64_t) * 3 + sizeof(uint32_t) + sizeof(IconHash) + sizeof(ArenaSlice));
+			bytes += value->rowIndices.capacity() * (sizeof(Pair<uint64_t, uint32_t>) + 1);
+			bytes += value->roleSetIndices.capacity() * (sizeof(Pair<uint64_t, uint32_t>) + 1);
+			bytes += value->roleSets.size() * (sizeof(ArenaSlice) + sizeof(uint32_t)) + value->roleArena.size() * sizeof(Snowflake);
+		}
+		return bytes;
+	}
+
+	GuildMemberStore::GuildColumns& GuildMemberStore::getColumns(Snowflake guildId) {
+		if (GuildColumns* columns = findColumns(guildId); columns) {
+			return *columns;
+		}
+		std::unique_lock lock{ guildMutex };
+		auto iter = guilds.find(guildId.operator const uint64_t&());
+		if (iter == guilds.end()) {
+			iter = guilds.emplace(guildId.operator const uint64_t&(), makeUnique<GuildColumns>());
+		}
+		return *iter->second;
+	}
+
+	GuildMemberStore::GuildColumns* GuildMemberStore::findColumns(Snowflake guildId) {
+		std::shared_lock lock{ guildMutex };
+		auto iter = guilds.find(guildId.operator const uint64_t&());
+		if (iter == guilds.end()) {
+			return nullptr;
+		}
+		return iter->second.get();
+	}
+
+	void GuildMemberStore::fillMember(const GuildColumns& columns, uint32_t row, Snowflake guildId, GuildMemberCacheData& guildMember) {
+		guildMember.guildId		= guildId;
+		guildMember.user.id		= columns.userIds[row];
+		guildMember.permissions = static_cast<int64_t>(columns.permissions[row]);
+		guildMember.joinedAt	= columns.joinedAts[row];
+		guildMember.avatar		= columns.avatars[row];
+		guildMember.flags		= columns.flags[row];
+		const ArenaSlice& roleSet{ columns.roleSets[columns.roleSetRows[row]] };
+		guildMember.roles.clear();
+		for (uint32_t x = 0; x < roleSet.length; ++x) {
+			guildMember.roles.emplace_back(columns.roleArena[roleSet.offset + x]);
+		}
+		const ArenaSlice& nick{ columns.nicks[row] };
+		guildMember.nick = columns.nickArena.substr(nick.offset, nick.length);
+	}
+
+	void GuildMemberStore::insertInternal(GuildColumns& columns, const GuildMemberCacheData& guildMember) {
+		if (guildMember.guildId == 0 || guildMember.user.id == 0) {
+			throw DCAException{ "Sorry, but there was no id set for that guildmember." };
+		}
+		uint64_t userId{ guildMember.user.id.operator const uint64_t&() };
+		uint32_t roleSet{ internRoleSet(columns, guildMember.roles) };
+		auto iter = columns.rowIndices.find(userId);
+		if (iter != columns.rowIndices.end()) {
+			uint32_t row{ iter->second };
+			releaseRoleSet(columns, columns.roleSetRows[row]);
+			columns.deadNickBytes += columns.nicks[row].length;
+			columns.nicks[row]		 = appendNick(columns, std::string_view{ guildMember.nick.data(), guildMember.nick.size() });
+			columns.permissions[row] = static_cast<uint64_t>(guildMember.permissions.operator int64_t());
+			columns.joinedAts[row]	 = static_cast<uint64_t>(guildMember.joinedAt.operator int64_t());
+			columns.avatars[row]	 = guildMember.avatar;
+			columns.flags[row]		 = guildMember.flags;
+			columns.roleSetRows[row] = roleSet;
+			reclaimArenas(columns);
+			return;
+		}
+		columns.rowIndices.emplace(userId, static_cast<uint32_t>(columns.userIds.size()));
+		columns.nicks.emplace_back(appendNick(columns, std::string_view{ guildMember.nick.data(), guildMember.nick.size() }));
+		columns.permissions.emplace_back(static_cast<uint64_t>(guildMember.permissions.operator int64_t()));
+		columns.joinedAts.emplace_back(static_cast<uint64_t>(guildMember.joinedAt.operator int64_t()));
+		columns.avatars.emplace_back(guildMember.avatar);
+		columns.flags.emplace_back(guildMember.flags);
+		columns.roleSetRows.emplace_back(roleSet);
+		columns.userIds.emplace_back(userId);
+	}
+
+	uint32_t GuildMemberStore::internRoleSet(GuildColumns& columns, const Jsonifier::Vector<Snowflake>& roles) {
+		uint64_t roleSetHash{ getRoleSetHash(roles.data(), roles.size()) };
+		for (auto iter = columns.roleSetIndices.find(roleSetHash); iter != columns.roleSetIndices.end(); iter = columns.roleSetIndices.find(++roleSetHash)) {
+			const ArenaSlice& roleSet{ columns.roleSets[iter->second] };
+			bool doWeMatch{ roleSet.length == roles.size() };
+			for (uint32_t x = 0; doWeMatch && x < roleSet.length; ++x) {
+				doWeMatch = columns.roleArena[roleSet.offset + x] == roles[x];
+			}
+			if (doWeMatch) {
+				if (columns.roleSetRefCounts[iter->second]++ == 0) {
+					--columns.deadRoleSets;
+				}
+				return iter->second;
+			}
+		}
+		ArenaSlice roleSet{ static_cast<uint32_t>(columns.roleArena.size()), static_cast<uint32_t>(roles.size()) };
+		for (auto& value: roles) {
+			columns.roleArena.emplace_back(value);
+		}
+		uint32_t roleSetIndex{ static_cast<uint32_t>(columns.roleSets.size()) };
+		columns.roleSets.emplace_back(roleSet);
+		columns.roleSetRefCounts.emplace_back(1);
+		columns.roleSetIndices.emplace(roleSetHash, roleSetIndex);
+		return roleSetIndex;
+	}
+
+	void GuildMemberStore::releaseRoleSet(GuildColumns& columns, uint32_t roleSet) {
+		if (--columns.roleSetRefCounts[roleSet] == 0) {
+			++columns.deadRoleSets;
+		}
+	}
+
+	void GuildMemberStore::indexRoleSet(GuildColumns& columns, uint32_t roleSet) {
+		const ArenaSlice& slice{ columns.roleSets[roleSet] };
+		uint64_t roleSetHash{ getRoleSetHash(columns.roleArena.data() + slice.offset, slice.length) };
+		while (columns.roleSetIndices.contains(roleSetHash)) {
+			++roleSetHash;
+		}
+		columns.roleSetIndices.emplace(roleSetHash, roleSet);
+	}
+
+	uint64_t GuildMemberStore::getRoleSetHash(const Snowflake* roles, uint64_t length) {
+		return KeyHasher{}(std::string_view{ reinterpret_cast<const char*>(roles), length * sizeof(Snowflake) });
+	}
+
+	void GuildMemberStore::compactRoleSets(GuildColumns& columns) {
+		Jsonifier::Vector<uint32_t> newIndices{};
+		Jsonifier::Vector<uint32_t> roleSetRefCounts{};
+		Jsonifier::Vector<ArenaSlice> roleSets{};
+		Jsonifier::Vector<Snowflake> roleArena{};
+		newIndices.resize(columns.roleSets.size());
+		for (uint32_t x = 0; x < columns.roleSets.size(); ++x) {
+			if (columns.roleSetRefCounts[x] == 0) {
+				continue;
+			}
+			const ArenaSlice& roleSet{ columns.roleSets[x] };
+			newIndices[x] = static_cast<uint32_t>(roleSets.size());
+			roleSets.emplace_back(ArenaSlice{ static_cast<uint32_t>(roleArena.size()), roleSet.length });
+			roleSetRefCounts.emplace_back(columns.roleSetRefCounts[x]);
+			for (uint32_t y = 0; y < roleSet.length; ++y) {
+				roleArena.emplace_back(columns.roleArena[roleSet.offset + y]);
+			}
+		}
+		for (auto& value: columns.roleSetRows) {
+			value = newIndices[value];
+		}
+		columns.roleSetRefCounts = std::move(roleSetRefCounts);
+		columns.roleArena		 = std::move(roleArena);
+		columns.roleSets		 = std::move(roleSets);
+		columns.deadRoleSets	 = 0;
+		columns.roleSetIndices.clear();
+		for (uint32_t x = 0; x < columns.roleSets.size(); ++x) {
+			indexRoleSet(columns, x);
+		}
+	}
+
+	void GuildMemberStore::reclaimArenas(GuildColumns& columns) {
+		if (columns.deadNickBytes > 4096 && columns.deadNickBytes > columns.nickArena.size() / 2) {
+			compactNicks(columns);
+		}
+		if (columns.deadRoleSets > 64 && columns.deadRoleSets > columns.roleSets.size() / 2) {
+			compactRoleSets(columns);
+		}
+	}
+
+	GuildMemberStore::ArenaSlice GuildMemberStore::appendNick(GuildColumns& columns, std::string_view nick) {
+		ArenaSlice slice{ static_cast<uint32_t>(columns.nickArena.size()), static_cast<uint32_t>(nick.size()) };
+		columns.nickArena.append(nick);
+		return slice;
+	}
+
+	void GuildMemberStore::compactNicks(GuildColumns& columns) {
+		std::string nickArena{};
+		nickArena.reserve(columns.nickArena.size() - columns.deadNickBytes);
+		for (auto& value: columns.nicks) {
+			uint32_t offset{ static_cast<uint32_t>(nickArena.size()) };
+			nickArena.append(columns.nickArena, value.offset, value.length);
+			value.offset = offset;
+		}
+		columns.nickArena	  = std::move(nickArena);
+		columns.deadNickBytes = 0;
+	}
+
 	void GuildMembers::initialize(DiscordCoreInternal::HttpsClient* client, ConfigManager* configManagerNew) {
-		GuildMembers::doWeCacheGuildMembersBool = configManagerNew->doWeCacheGuildMembers();
+		GuildMembers::doWeCompactGuildMembersBool = configManagerNew->doWeCompactGuildMembers();
+		GuildMembers::doWeCacheGuildMembersBool	  = configManagerNew->doWeCacheGuildMembers();
+		GuildMembers::fetchCoalescer.setNegativeTtl(configManagerNew->getNegativeCacheTtl());
+		GuildMembers::cache.setLimits(configManagerNew->getCacheOptions().guildMemberLimits);
 		GuildMembers::httpsClient				= client;
 	}
 
@@ -158,8 +420,12 @@ namespace DiscordCoreAPI {
 		data.user.id = dataPackage.guildMemberId;
 		data.guildId = dataPackage.guildId;
 		TwoIdKey key{ data };
-		if (cache.contains(key)) {
-			data = cache[key];
+		if (GuildMemberCacheData cachedData{}; doWeCompactGuildMembersBool && memberStore.find(key, cachedData)) {
+			data = cachedData;
+		} else {
+			cache.visit(key, [&](const GuildMemberCacheData& value) {
+				data = value;
+			});
 		}
 		GuildMembers::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheGuildMembersBool) {
@@ -173,11 +439,21 @@ namespace DiscordCoreAPI {
 		data.user.id = dataPackage.guildMemberId;
 		data.guildId = dataPackage.guildId;
 		TwoIdKey key{ data };
-		if (cache.contains(key)) {
-			return cache[key];
-		} else {
+		auto fetchGuildMember = [&]() -> GuildMemberCacheData {
 			return GuildMembers::getGuildMemberAsync(dataPackage).get();
+		};
+		if (doWeCompactGuildMembersBool) {
+			if (!memberStore.find(key, data)) {
+				data = fetchCoalescer.run(key, fetchGuildMember);
+			}
+			return data;
 		}
+		if (cache.visit(key, [&](const GuildMemberCacheData& value) {
+				data = value;
+			})) {
+			return data;
+		}
+		return fetchCoalescer.run(key, fetchGuildMember);
 	}
 
 	CoRoutine<Jsonifier::Vector<GuildMemberData>> GuildMembers::listGuildMembersAsync(ListGuildMembersData dataPackage) {
@@ -259,8 +535,12 @@ namespace DiscordCoreAPI {
 		data.user.id = dataPackage.guildMemberId;
 		data.guildId = dataPackage.guildId;
 		TwoIdKey key{ data };
-		if (cache.contains(key)) {
-			data = cache[key];
+		if (GuildMemberCacheData cachedData{}; doWeCompactGuildMembersBool && memberStore.find(key, cachedData)) {
+			data = cachedData;
+		} else {
+			cache.visit(key, [&](const GuildMemberCacheData& value) {
+				data = value;
+			});
 		}
 		GuildMembers::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheGuildMembersBool) {
@@ -349,21 +629,28 @@ namespace DiscordCoreAPI {
 			if (guildMember.guildId == 0 || guildMember.user.id == 0) {
 				throw DCAException{ "Sorry, but there was no id set for that guildmember." };
 			}
-			auto newMember = guildMember;
-			cache.emplace(std::forward<GuildMemberCacheData>(guildMember));
+			if (doWeCompactGuildMembersBool) {
+				memberStore.insert(guildMember);
+			} else {
+				cache.emplace(std::forward<GuildMemberCacheData>(guildMember));
+			}
 		}
 	}
 
 	VoiceStateDataLight GuildMembers::getVoiceStateData(const TwoIdKey& key) {
-		if (vsCache.contains(key)) {
-			return vsCache[key];
-		} else {
-			return {};
-		}
+		VoiceStateDataLight data{};
+		vsCache.visit(key, [&](const VoiceStateDataLight& value) {
+			data = value;
+		});
+		return data;
 	}
 
 	void GuildMembers::removeGuildMember(const TwoIdKey& key) {
-		cache.erase(key);
+		if (doWeCompactGuildMembersBool) {
+			memberStore.erase(key);
+		} else {
+			cache.erase(key);
+		}
 	};
 
 	void GuildMembers::removeVoiceState(const TwoIdKey& key) {
@@ -374,8 +661,15 @@ namespace DiscordCoreAPI {
 		return GuildMembers::doWeCacheGuildMembersBool;
 	}
 
+	bool GuildMembers::doWeCompactGuildMembers() {
+		return GuildMembers::doWeCompactGuildMembersBool;
+	}
+
 	ObjectCache<VoiceStateDataLight> GuildMembers::vsCache{};
+	RequestCoalescer<TwoIdKey, GuildMemberCacheData> GuildMembers::fetchCoalescer{};
 	ObjectCache<GuildMemberCacheData> GuildMembers::cache{};
 	DiscordCoreInternal::HttpsClient* GuildMembers::httpsClient{};
+	bool GuildMembers::doWeCompactGuildMembersBool{};
 	bool GuildMembers::doWeCacheGuildMembersBool{};
+	GuildMemberStore GuildMembers::memberStore{};
 };// namespace DiscordCoreAPI
@@ -98,6 +98,7 @@ namespace DiscordCoreAPI {
 		void HttpsRnRBuilder::updateRateLimitData(RateLimitData& rateLimitData) {
 			auto connection{ static_cast<HttpsConnection*>(this) };
 			if (connection->data.responseHeaders.contains("x-ratelimit-bucket")) {
+				std::unique_lock lock{ rateLimitData.accessMutex };
 				rateLimitData.bucket = connection->data.responseHeaders["x-ratelimit-bucket"];
 			}
 			if (connection->data.responseHeaders.contains("x-ratelimit-reset-after")) {
@@ -289,7 +290,9 @@ namespace DiscordCoreAPI {
 
 		void HttpsConnection::resetValues(HttpsWorkloadData&& workloadDataNew) {
 			if (currentBaseUrl != workloadDataNew.baseUrl) {
-				tcpConnection.reset();
+				if (currentBaseUrl != "") {
+					disconnect();
+				}
 				currentBaseUrl = workloadDataNew.baseUrl;
 			}
 			workload = std::move(workloadDataNew);
@@ -301,12 +304,158 @@ namespace DiscordCoreAPI {
 			data = HttpsResponseData{};
 		}
 
-		HttpsConnection& HttpsConnectionManager::getConnection(HttpsWorkloadType workloadType) {
+		std::string HttpsConnectionPool::getHost(const std::string& baseUrl) {
+			std::string_view host{ baseUrl };
+			if (auto httpsFind = host.find("https://"); httpsFind != std::string_view::npos) {
+				host = host.substr(httpsFind + std::string_view{ "https://" }.size());
+			}
+			if (auto slashFind = host.find('/'); slashFind != std::string_view::npos) {
+				host = host.substr(0, slashFind);
+			}
+			return std::string{ host };
+		}
+
+		void HttpsConnectionPool::pruneIdleConnections(Jsonifier::Vector<UniquePtr<HttpsConnection>>& hostConnections) {
+			Milliseconds currentTime = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch());
+			for (uint64_t x = 0; x < hostConnections.size() && hostConnections.size() > options.minConnectionsPerHost;) {
+				if (!hostConnections[x]->areWeInUse && currentTime - hostConnections[x]->lastTimeUsed >= Milliseconds{ options.idleTimeoutInMs }) {
+					hostConnections[x]->disconnect();
+					hostConnections.erase(hostConnections.begin() + static_cast<int64_t>(x));
+				} else {
+					++x;
+				}
+			}
+		}
+
+		HttpsConnection& HttpsConnectionPool::acquireConnection(const std::string& baseUrl) {
+			std::unique_lock lock{ accessMutex };
+			auto& hostConnections = connections[getHost(baseUrl)];
+			pruneIdleConnections(hostConnections);
+			while (true) {
+				HttpsConnection* idleConnection{};
+				for (auto& value: hostConnections) {
+					if (!value->areWeInUse && (!idleConnection || value->lastTimeUsed > idleConnection->lastTimeUsed)) {
+						idleConnection = value.get();
+					}
+				}
+				if (idleConnection) {
+					idleConnection->areWeInUse = true;
+					return *idleConnection;
+				}
+				if (hostConnections.size() < options.maxConnectionsPerHost) {
+					hostConnections.emplace_back(makeUnique<HttpsConnection>());
+					auto& newConnection		  = hostConnections[hostConnections.size() - 1];
+					newConnection->areWeInUse = true;
+					return *newConnection;
+				}
+				conditionVariable.wait(lock);
+			}
+		}
+
+		void HttpsConnectionPool::releaseConnection(HttpsConnection& connection) {
+			if (!connection.areWeConnected() || connection.tcpConnection.currentStatus != ConnectionStatus::NO_Error ||
+				connection.data.currentState != HttpsState::Complete || connection.data.responseCode == static_cast<uint32_t>(-1)) {
+				connection.disconnect();
+			}
+			std::unique_lock lock{ accessMutex };
+			connection.lastTimeUsed = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch());
+			connection.areWeInUse	= false;
+			lock.unlock();
+			conditionVariable.notify_one();
+		}
+
+		void HttpsConnectionPool::setOptions(const HttpsOptions& optionsNew) {
 			std::unique_lock lock{ accessMutex };
-			if (!httpsConnections.contains(workloadType)) {
-				httpsConnections.emplace(workloadType, makeUnique<HttpsConnection>());
+			options = optionsNew;
+			if (options.maxConnectionsPerHost == 0) {
+				options.maxConnectionsPerHost = 1;
+			}
+		}
+
+		HttpsOptions HttpsConnectionPool::getOptions() {
+			std::unique_lock lock{ accessMutex };
+			return options;
+		}
+
+		int64_t RateLimitData::getMaxRequestCount(int64_t maxRequestsPerBucket) {
+			if (areWeASpecialBucket.load(std::memory_order_acquire) || doWeWait.load(std::memory_order_acquire)) {
+				return 1;
+			}
+			return std::clamp(getsRemaining.load(std::memory_order_acquire), static_cast<int64_t>(1), maxRequestsPerBucket);
+		}
+
+		HttpsRequestScheduler::HttpsRequestScheduler() {
+			timerThread = ThreadWrapper([=, this](StopToken stopToken) {
+				runTimers(stopToken);
+			});
+		}
+
+		void HttpsRequestScheduler::waitForTurn(const HttpsWorkloadData& workload) {
+			int64_t ticket{ workload.thisWorkerId.load(std::memory_order_acquire) };
+			if (ticket == 0) {
+				return;
+			}
+			auto& workloadId = HttpsWorkloadData::workloadIdsInternal[workload.getWorkloadType()];
+			BlockingRegion blockingRegion{};
+			std::unique_lock lock{ accessMutex };
+			workloadConditions[static_cast<uint64_t>(workload.getWorkloadType())].wait(lock, [&] {
+				return workloadId->load(std::memory_order_acquire) >= ticket;
+			});
+		}
+
+		void HttpsRequestScheduler::advanceTurn(HttpsWorkloadType workloadType) {
+			auto& workloadId = HttpsWorkloadData::workloadIdsInternal[workloadType];
+			std::unique_lock lock{ accessMutex };
+			workloadId->store(workloadId->load(std::memory_order_acquire) + 1, std::memory_order_release);
+			lock.unlock();
+			workloadConditions[static_cast<uint64_t>(workloadType)].notify_all();
+		}
+
+		void HttpsRequestScheduler::waitForBucket(RateLimitData& rateLimitData, Milliseconds targetTime) {
+			BlockingRegion blockingRegion{};
+			std::unique_lock bucketLock{ rateLimitData.accessMutex };
+			if (targetTime > rateLimitData.resumeTime) {
+				rateLimitData.resumeTime = targetTime;
+				bucketLock.unlock();
+				std::unique_lock lock{ accessMutex };
+				timers.emplace(TimerData{ &rateLimitData, targetTime });
+				lock.unlock();
+				timerCondition.notify_one();
+				bucketLock.lock();
+			}
+			rateLimitData.conditionVariable.wait(bucketLock, [&] {
+				return std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) >= rateLimitData.resumeTime;
+			});
+		}
+
+		void HttpsRequestScheduler::runTimers(StopToken stopToken) {
+			std::unique_lock lock{ accessMutex };
+			while (!stopToken.stopRequested()) {
+				if (timers.empty()) {
+					timerCondition.wait(lock, [&] {
+						return stopToken.stopRequested() || !timers.empty();
+					});
+					continue;
+				}
+				TimerData timer{ timers.top() };
+				if (std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) < timer.targetTime) {
+					timerCondition.wait_until(lock, HRClock::time_point{ std::chrono::duration_cast<HRClock::duration>(timer.targetTime) });
+					continue;
+				}
+				timers.pop();
+				lock.unlock();
+				std::unique_lock bucketLock{ timer.rateLimitData->accessMutex };
+				bucketLock.unlock();
+				timer.rateLimitData->conditionVariable.notify_all();
+				lock.lock();
 			}
-			return *httpsConnections[workloadType].get();
+		}
+
+		HttpsRequestScheduler::~HttpsRequestScheduler() {
+			std::unique_lock lock{ accessMutex };
+			timerThread.requestStop();
+			lock.unlock();
+			timerCondition.notify_all();
 		}
 
 		RateLimitData& HttpsConnectionManager::getRateLimitData(HttpsWorkloadType workloadType) {
@@ -314,13 +463,12 @@ namespace DiscordCoreAPI {
 			return *rateLimitValues[rateLimitValueBuckets[workloadType]].get();
 		}
 
-		HttpsConnectionStackHolder::HttpsConnectionStackHolder(HttpsConnectionManager& connectionManager, HttpsWorkloadData&& workload) {
-			while (HttpsWorkloadData::workloadIdsInternal[workload.getWorkloadType()]->load(std::memory_order_acquire) < workload.thisWorkerId.load(std::memory_order_acquire) &&
-				workload.thisWorkerId.load(std::memory_order_acquire) != 0) {
-				std::this_thread::sleep_for(1ms);
+		HttpsConnectionStackHolder::HttpsConnectionStackHolder(HttpsConnectionPool& connectionPoolNew, HttpsWorkloadData&& workload) {
+			if (workload.baseUrl == "") {
+				workload.baseUrl = "https://discord.com/api/v10";
 			}
-			connection = &connectionManager.getConnection(workload.getWorkloadType());
-			connection->theSemaphore.acquire();
+			connectionPool = &connectionPoolNew;
+			connection	   = &connectionPool->acquireConnection(workload.baseUrl);
 			connection->resetValues(std::move(workload));
 			if (!connection->areWeConnected()) {
 				connection->tcpConnection = HttpsTCPConnection{ connection->workload.baseUrl, static_cast<uint16_t>(443), connection };
@@ -328,29 +476,153 @@ namespace DiscordCoreAPI {
 		}
 
 		HttpsConnectionStackHolder::~HttpsConnectionStackHolder() {
-			auto value = HttpsWorkloadData::workloadIdsInternal[connection->workload.getWorkloadType()]->load(std::memory_order_acquire);
-			HttpsWorkloadData::workloadIdsInternal[connection->workload.getWorkloadType()]->store(value + 1, std::memory_order_release);
-			connection->theSemaphore.release();
+			connectionPool->releaseConnection(*connection);
 		}
 
 		HttpsConnection& HttpsConnectionStackHolder::getConnection() {
 			return *connection;
 		}
 
-		RateLimitStackHolder::RateLimitStackHolder(HttpsConnectionManager& connectionManager, HttpsWorkloadType workloadType) {
-			rateLimitData = &connectionManager.getRateLimitData(workloadType);
-			rateLimitData->theSemaphore.acquire();
+		RateLimitStackHolder::RateLimitStackHolder(HttpsConnectionManager& connectionManager, const HttpsWorkloadData& workload) {
+			connectionManager.requestScheduler.waitForTurn(workload);
+			rateLimitData = &connectionManager.getRateLimitData(workload.getWorkloadType());
+			std::unique_lock lock{ rateLimitData->accessMutex };
+			rateLimitData->conditionVariable.wait(lock, [&] {
+				return rateLimitData->currentRequestCount < rateLimitData->getMaxRequestCount(connectionManager.maxRequestsPerBucket);
+			});
+			++rateLimitData->currentRequestCount;
+			lock.unlock();
+			connectionManager.requestScheduler.advanceTurn(workload.getWorkloadType());
 		}
 
 		RateLimitStackHolder::~RateLimitStackHolder() {
-			rateLimitData->theSemaphore.release();
+			std::unique_lock lock{ rateLimitData->accessMutex };
+			--rateLimitData->currentRequestCount;
+			lock.unlock();
+			rateLimitData->conditionVariable.notify_all();
 		}
 
 		RateLimitData& RateLimitStackHolder::getRateLimitData() {
 			return *rateLimitData;
 		}
 
-		void HttpsConnectionManager::initialize() {
+		void HttpsRangeExecutor::submit(std::function<void()>&& job) {
+			std::unique_lock lock{ accessMutex };
+			if (threads.size() == 0) {
+				uint64_t threadCount{ std::max<uint64_t>(ThreadWrapper::hardware_concurrency(), 2) };
+				for (uint64_t x = 0; x < threadCount; ++x) {
+					threads.emplace_back([this](StopToken stopToken) {
+						run(stopToken);
+					});
+				}
+			}
+			jobs.emplace_back(std::move(job));
+			lock.unlock();
+			conditionVariable.notify_one();
+		}
+
+		void HttpsRangeExecutor::run(StopToken stopToken) {
+			std::unique_lock lock{ accessMutex };
+			while (!stopToken.stopRequested()) {
+				if (jobs.empty()) {
+					conditionVariable.wait(lock, [&] {
+						return !jobs.empty() || stopToken.stopRequested();
+					});
+					continue;
+				}
+				std::function<void()> job{ std::move(jobs.front()) };
+				jobs.pop_front();
+				lock.unlock();
+				job();
+				lock.lock();
+			}
+		}
+
+		HttpsRangeExecutor::~HttpsRangeExecutor() {
+			std::unique_lock lock{ accessMutex };
+			for (auto& value: threads) {
+				value.requestStop();
+			}
+			lock.unlock();
+			conditionVariable.notify_all();
+			for (auto& value: threads) {
+				if (value.joinable()) {
+					value.join();
+				}
+			}
+		}
+
+		HttpsRangePrefetcher::HttpsRangePrefetcher(HttpsClientCore& clientNew, Jsonifier::Vector<HttpsWorkloadData>&& workloadsNew, const StreamingOptions& options) {
+			client		= &clientNew;
+			workloads	= std::move(workloadsNew);
+			rangesAhead = std::max<uint64_t>(options.maxRequestsInFlight, 1);
+			ranges.resize(workloads.size());
+			std::unique_lock lock{ accessMutex };
+			startRanges();
+		}
+
+		bool HttpsRangePrefetcher::collectResponse(HttpsResponseData& responseData) {
+			std::unique_lock lock{ accessMutex };
+			if (collectedIndex >= ranges.size()) {
+				return false;
+			}
+			BlockingRegion blockingRegion{};
+			conditionVariable.wait(lock, [&] {
+				return ranges[collectedIndex].isItComplete;
+			});
+			RangeData range{ std::move(ranges[collectedIndex]) };
+			++collectedIndex;
+			startRanges();
+			lock.unlock();
+			if (range.error) {
+				std::rethrow_exception(range.error);
+			}
+			responseData = std::move(range.responseData);
+			return true;
+		}
+
+		/// Called with the access mutex held.
+		void HttpsRangePrefetcher::startRanges() {
+			while (!areWeStopping && nextIndex < workloads.size() && nextIndex < collectedIndex + rangesAhead) {
+				uint64_t index{ nextIndex++ };
+				++runningCount;
+				executor.submit([this, index] {
+					runRequest(index);
+				});
+			}
+		}
+
+		void HttpsRangePrefetcher::runRequest(uint64_t index) {
+			std::unique_lock lock{ accessMutex };
+			RangeData range{};
+			if (!areWeStopping) {
+				HttpsWorkloadData workload{ std::move(workloads[index]) };
+				lock.unlock();
+				try {
+					range.responseData = client->submitWorkloadAndGetResult(std::move(workload));
+				} catch (...) {
+					range.error = std::current_exception();
+				}
+				lock.lock();
+			}
+			ranges[index]			   = std::move(range);
+			ranges[index].isItComplete = true;
+			--runningCount;
+			lock.unlock();
+			conditionVariable.notify_all();
+		}
+
+		HttpsRangePrefetcher::~HttpsRangePrefetcher() {
+			std::unique_lock lock{ accessMutex };
+			areWeStopping = true;
+			BlockingRegion blockingRegion{};
+			conditionVariable.wait(lock, [&] {
+				return runningCount == 0;
+			});
+		}
+
+		void HttpsConnectionManager::initialize(const HttpsOptions& optionsNew) {
+			maxRequestsPerBucket = optionsNew.maxRequestsPerBucket > 0 ? static_cast<int64_t>(optionsNew.maxRequestsPerBucket) : 1;
 			for (int64_t enumOne = static_cast<int64_t>(HttpsWorkloadType::Unset); enumOne != static_cast<int64_t>(HttpsWorkloadType::LAST); enumOne++) {
 				UniquePtr<RateLimitData> rateLimitData{ makeUnique<RateLimitData>() };
 				rateLimitData->tempBucket = std::to_string(std::chrono::duration_cast<Nanoseconds>(HRClock::now().time_since_epoch()).count());
@@ -360,17 +632,11 @@ namespace DiscordCoreAPI {
 			}
 		}
 
-		HttpsClient::HttpsClient(const std::string& botTokenNew) : HttpsClientCore(botTokenNew), connectionManager() {
-			connectionManager.initialize();
+		HttpsClient::HttpsClient(const std::string& botTokenNew, const HttpsOptions& optionsNew) : HttpsClientCore(botTokenNew), connectionManager() {
+			connectionPool.setOptions(optionsNew);
+			connectionManager.initialize(optionsNew);
 		};
 
-		HttpsResponseData HttpsClient::httpsRequest(HttpsConnection& connection) {
-			RateLimitStackHolder rateLimitData{ connectionManager, connection.workload.workloadType };
-
-			HttpsResponseData resultData = executeByRateLimitData(connection, rateLimitData.getRateLimitData());
-			return resultData;
-		}
-
 		HttpsResponseData HttpsClientCore::httpsRequestInternal(HttpsConnection& connection, RateLimitData& rateLimitData) {
 			if (connection.workload.baseUrl == "https://discord.com/api/v10") {
 				connection.workload.headersToInsert.emplace("Authorization", "Bot " + botToken);
@@ -439,31 +705,26 @@ namespace DiscordCoreAPI {
 			}
 			if (timeRemaining.count() > 0) {
 				MessagePrinter::printSuccess<PrintMessageType::Https>("We're waiting on rate-limit: " + std::to_string(timeRemaining.count()));
-				Milliseconds targetTime{ currentTime + timeRemaining };
-				while (targetTime > currentTime && targetTime.count() > 0 && currentTime.count() > 0 && timeRemaining.count() > 0) {
-					currentTime	  = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch());
-					timeRemaining = targetTime - currentTime;
-					if (timeRemaining.count() <= 20) {
-						continue;
-					} else {
-						std::this_thread::sleep_for(Milliseconds{ static_cast<int64_t>(static_cast<double>(timeRemaining.count()) * 80.0f / 100.0f) });
-					}
-				}
+				connectionManager.requestScheduler.waitForBucket(rateLimitData, currentTime + timeRemaining);
 			}
 
 			returnData = HttpsClient::httpsRequestInternal(connection, rateLimitData);
 			rateLimitData.sampledTimeInMs.store(std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()), std::memory_order_release);
 
+			std::unique_lock rateLimitLock{ rateLimitData.accessMutex };
 			if (rateLimitData.tempBucket != "") {
 				rateLimitData.tempBucket = "";
 			}
 			std::string currentBucket = rateLimitData.bucket;
-			if (!connectionManager.rateLimitValues.contains(rateLimitData.bucket)) {
+			rateLimitLock.unlock();
+			std::unique_lock managerLock{ connectionManager.accessMutex };
+			if (!connectionManager.rateLimitValues.contains(currentBucket)) {
 				UniquePtr<RateLimitData> rateLimitDataNew{ makeUnique<RateLimitData>() };
 				connectionManager.rateLimitValues[connectionManager.rateLimitValueBuckets[connection.workload.workloadType]].swap(rateLimitDataNew);
 				connectionManager.rateLimitValueBuckets[connection.workload.workloadType] = currentBucket;
 				connectionManager.rateLimitValues.emplace(currentBucket, std::move(rateLimitDataNew));
 			}
+			managerLock.unlock();
 			if (returnData.responseCode == 204 || returnData.responseCode == 201 || returnData.responseCode == 200) {
 				MessagePrinter::printSuccess<PrintMessageType::Https>(
 					connection.workload.callStack + " Success: " + static_cast<std::string>(returnData.responseCode) + ": " + returnData.responseData);
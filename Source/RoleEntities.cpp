@@ -144,6 +144,8 @@ namespace DiscordCoreAPI {
 
 	void Roles::initialize(DiscordCoreInternal::HttpsClient* client, ConfigManager* configManagerNew) {
 		Roles::doWeCacheRolesBool = configManagerNew->doWeCacheRoles();
+		Roles::fetchCoalescer.setNegativeTtl(configManagerNew->getNegativeCacheTtl());
+		Roles::cache.setLimits(configManagerNew->getCacheOptions().roleLimits);
 		Roles::httpsClient		  = client;
 	}
 
@@ -263,9 +265,9 @@ namespace DiscordCoreAPI {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		RoleData data{ dataPackage.roleId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
+		cache.visit(data.id, [&](const RoleCacheData& value) {
+			data = value;
+		});
 		Roles::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheRolesBool) {
 			insertRole(static_cast<RoleCacheData>(data));
@@ -307,9 +309,9 @@ namespace DiscordCoreAPI {
 			throw DCAException{ "Roles::getRoleAsync() Error: Sorry, but you forgot to set the guildId!" };
 		}
 		RoleData data{ dataPackage.roleId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
+		cache.visit(data.id, [&](const RoleCacheData& value) {
+			data = value;
+		});
 		for (auto& value: roles) {
 			if (value.id == dataPackage.roleId) {
 				data = std::move(value);
@@ -322,13 +324,15 @@ namespace DiscordCoreAPI {
 	}
 
 	RoleCacheData Roles::getCachedRole(GetRoleData dataPackage) {
-		RoleData data{};
-		data.id = dataPackage.roleId;
-		if (!cache.contains(data.id)) {
-			return Roles::getRoleAsync(dataPackage).get();
-		} else {
-			return cache[data.id];
+		RoleCacheData data{};
+		if (cache.visit(dataPackage.roleId, [&](const RoleCacheData& value) {
+				data = value;
+			})) {
+			return data;
 		}
+		return fetchCoalescer.run(dataPackage.roleId, [&]() -> RoleCacheData {
+			return Roles::getRoleAsync(dataPackage).get();
+		});
 	}
 
 	void Roles::insertRole(RoleCacheData&& role) {
@@ -349,6 +353,7 @@ namespace DiscordCoreAPI {
 	}
 
 	DiscordCoreInternal::HttpsClient* Roles::httpsClient{};
+	RequestCoalescer<Snowflake, RoleCacheData> Roles::fetchCoalescer{};
 	ObjectCache<RoleCacheData> Roles::cache{};
 	bool Roles::doWeCacheRolesBool{};
 };// namespace DiscordCoreAPI
@@ -49,6 +49,7 @@ namespace DiscordCoreAPI {
 	bool SongAPI::skip(const GuildMemberData& guildMember, bool wasItAFail) {
 		AudioFrameData dataFrame{};
 		audioDataBuffer.clearContents();
+		notifyQueueSpace();
 		auto returnValue		= DiscordCoreClient::getVoiceConnection(guildId).skip(wasItAFail);
 		dataFrame.guildMemberId = guildMember.user.id.operator const uint64_t&();
 		audioDataBuffer.send(std::move(dataFrame));
@@ -109,15 +110,36 @@ namespace DiscordCoreAPI {
 	bool SongAPI::stop() {
 		bool returnValue = DiscordCoreClient::getVoiceConnection(guildId).stop();
 		audioDataBuffer.clearContents();
+		notifyQueueSpace();
 		return returnValue;
 	}
 
+	void SongAPI::waitForQueueSpace(uint64_t maxQueuedFrames, const std::function<bool()>& areWeStopped) {
+		DiscordCoreInternal::BlockingRegion blockingRegion{};
+		std::unique_lock lock{ queueSpaceMutex };
+		queuedFramesWanted.store(maxQueuedFrames, std::memory_order_seq_cst);
+		while (audioDataBuffer.size() >= maxQueuedFrames && !areWeStopped()) {
+			queueSpaceCondition.wait_for(lock, 20ms);
+		}
+		queuedFramesWanted.store(0, std::memory_order_release);
+	}
+
+	void SongAPI::notifyQueueSpace() {
+		uint64_t wanted{ queuedFramesWanted.load(std::memory_order_seq_cst) };
+		if (wanted != 0 && audioDataBuffer.size() < wanted) {
+			std::unique_lock lock{ queueSpaceMutex };
+			lock.unlock();
+			queueSpaceCondition.notify_all();
+		}
+	}
+
 	void SongAPI::disconnect() {
 		if (taskThread.getStatus() == CoRoutineStatus::Running) {
 			taskThread.cancel();
 		}
 		onSongCompletionEvent.erase(eventToken);
 		audioDataBuffer.clearContents();
+		notifyQueueSpace();
 		StopWatch<std::chrono::milliseconds> stopWatch{ 10000ms };
 		while (DiscordCoreClient::getSoundCloudAPI(guildId).areWeWorking() || DiscordCoreClient::getYouTubeAPI(guildId).areWeWorking()) {
 			if (stopWatch.hasTimePassed()) {
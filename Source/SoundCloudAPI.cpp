@@ -275,7 +275,8 @@ namespace DiscordCoreAPI {
 		}
 
 		SoundCloudAPI::SoundCloudAPI(ConfigManager* configManagerNew, const Snowflake guildIdNew) : SoundCloudRequestBuilder{ configManagerNew } {
-			guildId = static_cast<Snowflake>(guildIdNew);
+			streamingOptions = configManagerNew->getStreamingOptions();
+			guildId			 = static_cast<Snowflake>(guildIdNew);
 			if (SoundCloudRequestBuilder::clientId == "") {
 				SoundCloudRequestBuilder::clientId = collectClientId();
 			}
@@ -317,10 +318,11 @@ namespace DiscordCoreAPI {
 					dataPackage03.workloadClass = HttpsWorkloadClass::Get;
 					workloadVector.emplace_back(std::move(dataPackage03));
 				}
-				Jsonifier::Vector<std::string> buffer{};
+				uint64_t maxQueuedFrames{ std::max<uint64_t>(streamingOptions.readAheadInSeconds, 1) * SongAPI::framesPerSecond };
+				HttpsRangePrefetcher prefetcher{ *this, std::move(workloadVector), streamingOptions };
 				OggDemuxer demuxer{};
-				for (uint64_t x = 0; x < songNew.finalDownloadUrls.size(); ++x) {
-					HttpsResponseData result{ submitWorkloadAndGetResult(std::move(workloadVector[x])) };
+				HttpsResponseData result{};
+				while (prefetcher.collectResponse(result)) {
 					if (result.responseCode != 200) {
 						areWeWorkingBool.store(false, std::memory_order_release);
 						weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
@@ -328,8 +330,7 @@ namespace DiscordCoreAPI {
 					}
 
 					if (result.responseData.size() > 0) {
-						buffer.emplace_back(std::move(result.responseData));
-						demuxer.writeData({ buffer.back().data(), buffer.back().size() });
+						demuxer.writeData(result.responseData);
 						demuxer.proceedDemuxing();
 					}
 					if (coroHandle.promise().areWeStopped()) {
@@ -349,11 +350,13 @@ namespace DiscordCoreAPI {
 							DiscordCoreClient::getSongAPI(guildId).audioDataBuffer.send(std::move(frameData));
 						}
 					} while (didWeReceive);
+					DiscordCoreClient::getSongAPI(guildId).waitForQueueSpace(maxQueuedFrames, [&] {
+						return coroHandle.promise().areWeStopped();
+					});
 					if (coroHandle.promise().areWeStopped()) {
 						areWeWorkingBool.store(false, std::memory_order_release);
 						co_return;
 					}
-					std::this_thread::sleep_for(1ms);
 				}
 				areWeWorkingBool.store(false, std::memory_order_release);
 				DiscordCoreClient::getVoiceConnection(guildId).skip(false);
@@ -235,6 +235,7 @@ namespace DiscordCoreAPI {
 			baseSocketAgent->discordCoreClient->baseSocketAgentsMap[basesocketAgentIndex]->getClient(shardId).createHeader(string,
 				baseSocketAgent->discordCoreClient->baseSocketAgentsMap[basesocketAgentIndex]->getClient(shardId).dataOpCode);
 			baseSocketAgent->discordCoreClient->baseSocketAgentsMap[basesocketAgentIndex]->getClient(shardId).sendMessage(string, false);
+			baseSocketAgent->discordCoreClient->baseSocketAgentsMap[basesocketAgentIndex]->reactor.wakeUp();
 		}
 	}
 
@@ -267,6 +268,8 @@ namespace DiscordCoreAPI {
 
 	void Users::initialize(DiscordCoreInternal::HttpsClient* client, ConfigManager* configManagerNew) {
 		Users::doWeCacheUsersBool = configManagerNew->doWeCacheUsers();
+		Users::fetchCoalescer.setNegativeTtl(configManagerNew->getNegativeCacheTtl());
+		Users::cache.setLimits(configManagerNew->getCacheOptions().userLimits);
 		Users::httpsClient		  = client;
 	}
 
@@ -319,19 +322,20 @@ namespace DiscordCoreAPI {
 		workload.callStack	   = "Users::getCurrentUserAsync()";
 		UserData returnData{};
 		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
-		auto newId = returnData.id;
 		insertUser(static_cast<UserCacheData>(returnData));
-		co_return cache[newId];
+		co_return returnData;
 	}
 
 	UserCacheData Users::getCachedUser(GetUserData dataPackage) {
-		UserData data{};
-		data.id = dataPackage.userId;
-		if (!cache.contains(data.id)) {
-			return getUserAsync(dataPackage).get();
-		} else {
-			return cache[dataPackage.userId];
+		UserCacheData data{};
+		if (cache.visit(dataPackage.userId, [&](const UserCacheData& value) {
+				data = value;
+			})) {
+			return data;
 		}
+		return fetchCoalescer.run(dataPackage.userId, [&]() -> UserCacheData {
+			return getUserAsync(dataPackage).get();
+		});
 	}
 
 	CoRoutine<UserData> Users::getUserAsync(GetUserData dataPackage) {
@@ -341,9 +345,9 @@ namespace DiscordCoreAPI {
 		workload.relativePath  = "/users/" + dataPackage.userId;
 		workload.callStack	   = "Users::getUserAsync()";
 		UserData data{ dataPackage.userId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
+		cache.visit(data.id, [&](const UserCacheData& value) {
+			data = value;
+		});
 		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
 		if (doWeCacheUsersBool) {
 			insertUser(static_cast<UserCacheData>(data));
@@ -414,6 +418,7 @@ namespace DiscordCoreAPI {
 	}
 
 	DiscordCoreInternal::HttpsClient* Users::httpsClient{};
+	RequestCoalescer<Snowflake, UserCacheData> Users::fetchCoalescer{};
 	ObjectCache<UserCacheData> Users::cache{};
 	bool Users::doWeCacheUsersBool{};
 }// namespace DiscordCoreAPI
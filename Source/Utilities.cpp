@@ -108,6 +108,26 @@ namespace DiscordCoreAPI {
 		return config.cacheOptions.cacheGuildMembers;
 	}
 
+	bool ConfigManager::doWeCompactGuildMembers() const {
+		return config.cacheOptions.compactGuildMembers;
+	}
+
+	bool ConfigManager::doWeCachePermissions() const {
+		return config.cacheOptions.cachePermissions;
+	}
+
+	Milliseconds ConfigManager::getNegativeCacheTtl() const {
+		return Milliseconds{ config.cacheOptions.negativeCacheTtlInMs };
+	}
+
+	std::string ConfigManager::getSnapshotPath() const {
+		return config.cacheOptions.snapshotPath;
+	}
+
+	Milliseconds ConfigManager::getSnapshotInterval() const {
+		return Milliseconds{ config.cacheOptions.snapshotIntervalInMs };
+	}
+
 	bool ConfigManager::doWeCacheChannels() const {
 		return config.cacheOptions.cacheChannels;
 	}
@@ -124,6 +144,18 @@ namespace DiscordCoreAPI {
 		return config.cacheOptions.cacheRoles;
 	}
 
+	CacheOptions ConfigManager::getCacheOptions() const {
+		return config.cacheOptions;
+	}
+
+	HttpsOptions ConfigManager::getHttpsOptions() const {
+		return config.httpsOptions;
+	}
+
+	StreamingOptions ConfigManager::getStreamingOptions() const {
+		return config.streamingOptions;
+	}
+
 	UpdatePresenceData ConfigManager::getPresenceData() const {
 		return config.presenceData;
 	}
@@ -168,6 +200,10 @@ namespace DiscordCoreAPI {
 		return config.textFormat;
 	}
 
+	GatewayCompression ConfigManager::getGatewayCompression() const {
+		return config.compression;
+	}
+
 	GatewayIntents ConfigManager::getGatewayIntents() {
 		return config.intents;
 	}
@@ -176,10 +212,27 @@ namespace DiscordCoreAPI {
 		type = frameTypeNew;
 	}
 
+	AudioFrameData& AudioFrameData::operator=(AudioFrameData&& other) noexcept {
+		if (this != &other) {
+			DiscordCoreInternal::AudioFramePool::release(std::move(data));
+			data		  = std::move(other.data);
+			guildMemberId = other.guildMemberId;
+			currentSize	  = other.currentSize;
+			type		  = other.type;
+			other.data	  = Jsonifier::Vector<uint8_t>{};
+		}
+		return *this;
+	}
+
+	AudioFrameData::AudioFrameData(AudioFrameData&& other) noexcept {
+		*this = std::move(other);
+	}
+
 	AudioFrameData& AudioFrameData::operator+=(std::basic_string_view<uint8_t> other) {
 		if (other.size() > 0) {
 			if (data.size() < other.size()) {
-				data.resize(other.size());
+				DiscordCoreInternal::AudioFramePool::release(std::move(data));
+				data = DiscordCoreInternal::AudioFramePool::acquire(other.size());
 			}
 			std::memcpy(data.data(), other.data(), other.size());
 		}
@@ -191,7 +244,12 @@ namespace DiscordCoreAPI {
 		type		  = AudioFrameType::Unset;
 		guildMemberId = 0;
 		currentSize	  = 0;
-		data.clear();
+		DiscordCoreInternal::AudioFramePool::release(std::move(data));
+		data = Jsonifier::Vector<uint8_t>{};
+	}
+
+	AudioFrameData::~AudioFrameData() {
+		DiscordCoreInternal::AudioFramePool::release(std::move(data));
 	}
 
 	ColorValue::ColorValue(uint32_t colorValue) {
@@ -273,106 +331,133 @@ namespace DiscordCoreAPI {
 		return stoull(std::string{ string });
 	}
 
-	template<> std::string PermissionsBase<Permissions>::computeOverwrites(const std::string& basePermissions, const GuildMemberData& guildMember, const ChannelData& channel) {
-		if ((stoull(basePermissions) & static_cast<uint64_t>(Permission::Administrator)) & static_cast<uint64_t>(Permission::Administrator)) {
-			return getAllPermissions();
-		}
+	void PermissionEvaluator::initialize(ConfigManager* configManagerNew) {
+		PermissionEvaluator::doWeMemoize = configManagerNew->doWeCachePermissions();
+	}
 
-		uint64_t permissions = stoull(basePermissions);
-		for (auto value: channel.permissionOverwrites) {
-			if (value.id == guildMember.guildId) {
-				permissions &= ~value.deny;
-				permissions |= value.allow;
-				break;
-			}
+	uint64_t PermissionEvaluator::computeBasePermissions(const GuildMemberData& guildMember) {
+		if (getGuildOwnerId(guildMember.guildId) == guildMember.user.id) {
+			return allPermissions;
 		}
-		Jsonifier::Vector<RoleData> guildMemberRoles{};
+		uint64_t permissions{ getRolePermissions(guildMember.guildId, guildMember.guildId) };
 		for (auto& value: guildMember.roles) {
-			guildMemberRoles.emplace_back(Roles::getCachedRole({ .guildId = guildMember.guildId, .roleId = value }));
+			permissions |= getRolePermissions(guildMember.guildId, value);
 		}
-		uint64_t allow{};
-		uint64_t deny{};
-		for (auto& value: guildMemberRoles) {
-			for (auto value02: channel.permissionOverwrites) {
-				if (value.id == value02.id) {
-					allow |= value02.allow;
-					deny |= value02.deny;
-				}
-			}
-		}
-		permissions &= ~deny;
-		permissions |= allow;
-		for (auto value: channel.permissionOverwrites) {
-			if (value.id == guildMember.user.id) {
-				permissions &= ~value.deny;
-				permissions |= value.allow;
-				break;
-			}
+		if (permissions & static_cast<uint64_t>(Permission::Administrator)) {
+			return allPermissions;
 		}
-		return std::to_string(permissions);
+		return permissions;
 	}
 
-	template<> std::string PermissionsBase<Permissions>::computeBasePermissions(const GuildMemberData& guildMember) {
-		const GuildData guild = Guilds::getCachedGuild({ .guildId = guildMember.guildId });
-		if (guild.ownerId == guildMember.user.id) {
-			return getAllPermissions();
-		}
-		Jsonifier::Vector<RoleData> guildRoles{};
-		for (auto& value: guild.roles) {
-			guildRoles.emplace_back(Roles::getCachedRole({ .guildId = guild.id, .roleId = value.id }));
+	uint64_t PermissionEvaluator::computeOverwrites(uint64_t basePermissions, const GuildMemberData& guildMember, const ChannelData& channel) {
+		return computeOverwrites(basePermissions, guildMember, channel.permissionOverwrites);
+	}
+
+	uint64_t PermissionEvaluator::computePermissions(const GuildMemberData& guildMember, const ChannelData& channel) {
+		uint64_t permissions{};
+		uint64_t generation{};
+		if (doWeMemoize && findMemo(guildMember, channel.id, permissions, generation)) {
+			return permissions;
 		}
-		RoleData roleEveryone{};
-		for (auto& value: guildRoles) {
-			if (value.id == guild.id) {
-				roleEveryone = value;
-			}
+		permissions = computeOverwrites(computeBasePermissions(guildMember), guildMember, channel.permissionOverwrites);
+		if (doWeMemoize) {
+			insertMemo(guildMember, channel.id, permissions, generation);
 		}
+		return permissions;
+	}
+
+	uint64_t PermissionEvaluator::computePermissions(const GuildMemberData& guildMember, Snowflake channelId) {
 		uint64_t permissions{};
-		if (roleEveryone.permissions != "0") {
-			permissions = roleEveryone.permissions;
+		uint64_t generation{};
+		if (doWeMemoize && findMemo(guildMember, channelId, permissions, generation)) {
+			return permissions;
 		}
-		GetGuildMemberRolesData getRolesData{};
-		getRolesData.guildMember = guildMember;
-		getRolesData.guildId	 = guildMember.guildId;
-		Jsonifier::Vector<RoleData> guildMemberRoles{};
-		for (auto& value: guildMember.roles) {
-			auto valueNew = Roles::getCachedRole({ .guildId = guild.id, .roleId = value });
-			guildMemberRoles.emplace_back(valueNew);
+		uint64_t basePermissions{ computeBasePermissions(guildMember) };
+		if (!Channels::getCache().visit(channelId, [&](const ChannelCacheData& channel) {
+				permissions = computeOverwrites(basePermissions, guildMember, channel.permissionOverwrites);
+			})) {
+			ChannelCacheData channel = Channels::getCachedChannel({ .channelId = channelId });
+			permissions				 = computeOverwrites(basePermissions, guildMember, channel.permissionOverwrites);
 		}
-		for (auto& value: guildMemberRoles) {
-			permissions |= value.permissions.operator int64_t();
+		if (doWeMemoize) {
+			insertMemo(guildMember, channelId, permissions, generation);
 		}
+		return permissions;
+	}
 
-		if (permissions & static_cast<uint64_t>(Permission::Administrator)) {
-			return getAllPermissions();
+	bool PermissionEvaluator::checkForPermission(const GuildMemberData& guildMember, const ChannelData& channel, Permission permission) {
+		return (computePermissions(guildMember, channel) & static_cast<uint64_t>(permission)) == static_cast<uint64_t>(permission);
+	}
+
+	void PermissionEvaluator::invalidateGuild(Snowflake guildId) {
+		if (!doWeMemoize) {
+			return;
 		}
+		std::unique_lock lock{ memoMutex };
+		++generations[guildId.operator const uint64_t&()];
+		memo.erase(guildId.operator const uint64_t&());
+	}
 
-		return std::to_string(permissions);
+	void PermissionEvaluator::invalidateChannel(Snowflake guildId, Snowflake channelId) {
+		if (!doWeMemoize) {
+			return;
+		}
+		std::unique_lock lock{ memoMutex };
+		++generations[guildId.operator const uint64_t&()];
+		auto iter = memo.find(guildId.operator const uint64_t&());
+		if (iter == memo.end()) {
+			return;
+		}
+		Jsonifier::Vector<uint64_t> keysToErase{};
+		for (auto& [key, value]: iter->second) {
+			if (value.channelId == channelId) {
+				keysToErase.emplace_back(key);
+			}
+		}
+		for (auto& value: keysToErase) {
+			iter->second.erase(value);
+		}
 	}
 
-	template<>
-	std::string PermissionsBase<PermissionsParse>::computeOverwrites(const std::string& basePermissions, const GuildMemberData& guildMember, const ChannelData& channel) {
-		if ((stoull(basePermissions) & static_cast<uint64_t>(Permission::Administrator)) & static_cast<uint64_t>(Permission::Administrator)) {
-			return getAllPermissions();
+	void PermissionEvaluator::invalidateMember(Snowflake guildId, Snowflake userId) {
+		if (!doWeMemoize) {
+			return;
+		}
+		std::unique_lock lock{ memoMutex };
+		++generations[guildId.operator const uint64_t&()];
+		auto iter = memo.find(guildId.operator const uint64_t&());
+		if (iter == memo.end()) {
+			return;
+		}
+		Jsonifier::Vector<uint64_t> keysToErase{};
+		for (auto& [key, value]: iter->second) {
+			if (value.userId == userId) {
+				keysToErase.emplace_back(key);
+			}
+		}
+		for (auto& value: keysToErase) {
+			iter->second.erase(value);
 		}
+	}
 
-		uint64_t permissions = stoull(basePermissions);
-		for (auto value: channel.permissionOverwrites) {
+	uint64_t PermissionEvaluator::computeOverwrites(uint64_t basePermissions, const GuildMemberData& guildMember,
+		const Jsonifier::Vector<OverWriteData>& permissionOverwrites) {
+		if (basePermissions & static_cast<uint64_t>(Permission::Administrator)) {
+			return allPermissions;
+		}
+		uint64_t permissions{ basePermissions };
+		for (auto& value: permissionOverwrites) {
 			if (value.id == guildMember.guildId) {
 				permissions &= ~value.deny;
 				permissions |= value.allow;
 				break;
 			}
 		}
-		Jsonifier::Vector<RoleData> guildMemberRoles{};
-		for (auto& value: guildMember.roles) {
-			guildMemberRoles.emplace_back(Roles::getCachedRole({ .guildId = guildMember.guildId, .roleId = value }));
-		}
 		uint64_t allow{};
 		uint64_t deny{};
-		for (auto& value: guildMemberRoles) {
-			for (auto value02: channel.permissionOverwrites) {
-				if (value.id == value02.id) {
+		for (auto& value: guildMember.roles) {
+			for (auto& value02: permissionOverwrites) {
+				if (value == value02.id) {
 					allow |= value02.allow;
 					deny |= value02.deny;
 				}
@@ -380,54 +465,87 @@ namespace DiscordCoreAPI {
 		}
 		permissions &= ~deny;
 		permissions |= allow;
-		for (auto value: channel.permissionOverwrites) {
+		for (auto& value: permissionOverwrites) {
 			if (value.id == guildMember.user.id) {
 				permissions &= ~value.deny;
 				permissions |= value.allow;
 				break;
 			}
 		}
-		return std::to_string(permissions);
+		return permissions;
 	}
 
-	template<> std::string PermissionsBase<PermissionsParse>::computeBasePermissions(const GuildMemberData& guildMember) {
-		const GuildData guild = Guilds::getCachedGuild({ .guildId = guildMember.guildId });
-		if (guild.ownerId == guildMember.user.id) {
-			return getAllPermissions();
+	/// Hands back the Guild's generation on a miss, so that insertMemo() can tell whether an invalidation has landed since the result began computing.
+	bool PermissionEvaluator::findMemo(const GuildMemberData& guildMember, Snowflake channelId, uint64_t& permissions, uint64_t& generation) {
+		std::shared_lock lock{ memoMutex };
+		auto iterGeneration = generations.find(guildMember.guildId.operator const uint64_t&());
+		generation			= iterGeneration == generations.end() ? 0 : iterGeneration->second;
+		auto iter			= memo.find(guildMember.guildId.operator const uint64_t&());
+		if (iter == memo.end()) {
+			return false;
 		}
-		Jsonifier::Vector<RoleData> guildRoles{};
-		for (auto& value: guild.roles) {
-			guildRoles.emplace_back(Roles::getCachedRole({ .guildId = guild.id, .roleId = value.id }));
+		auto iterTwo = iter->second.find(getMemoKey(guildMember.user.id, channelId));
+		if (iterTwo == iter->second.end() || iterTwo->second.userId != guildMember.user.id || iterTwo->second.channelId != channelId ||
+			iterTwo->second.rolesHash != getRolesHash(guildMember.roles)) {
+			return false;
 		}
-		RoleData roleEveryone{};
-		for (auto& value: guildRoles) {
-			if (value.id == guild.id) {
-				roleEveryone = value;
-			}
+		permissions = iterTwo->second.permissions;
+		return true;
+	}
+
+	void PermissionEvaluator::insertMemo(const GuildMemberData& guildMember, Snowflake channelId, uint64_t permissions, uint64_t generation) {
+		std::unique_lock lock{ memoMutex };
+		auto iterGeneration = generations.find(guildMember.guildId.operator const uint64_t&());
+		if ((iterGeneration == generations.end() ? 0 : iterGeneration->second) != generation) {
+			return;
 		}
-		uint64_t permissions{};
-		if (roleEveryone.permissions != "0") {
-			permissions = roleEveryone.permissions;
+		auto& guildMemo = memo[guildMember.guildId.operator const uint64_t&()];
+		if (guildMemo.size() >= maxMemoSizePerGuild) {
+			guildMemo.clear();
 		}
-		GetGuildMemberRolesData getRolesData{};
-		getRolesData.guildMember = guildMember;
-		getRolesData.guildId	 = guildMember.guildId;
-		Jsonifier::Vector<RoleData> guildMemberRoles{};
-		for (auto& value: guildMember.roles) {
-			auto valueNew = Roles::getCachedRole({ .guildId = guild.id, .roleId = value });
-			guildMemberRoles.emplace_back(valueNew);
-		}
-		for (auto& value: guildMemberRoles) {
-			permissions |= value.permissions.operator int64_t();
+		guildMemo[getMemoKey(guildMember.user.id, channelId)] = MemoEntry{ permissions, getRolesHash(guildMember.roles), channelId, guildMember.user.id };
+	}
+
+	uint64_t PermissionEvaluator::getMemoKey(Snowflake userId, Snowflake channelId) {
+		uint64_t ids[2]{ userId.operator const uint64_t&(), channelId.operator const uint64_t&() };
+		return KeyHasher{}(std::string_view{ reinterpret_cast<const char*>(ids), sizeof(ids) });
+	}
+
+	/// Summed rather than chained, so that the same Roles listed in a different order hash the same.
+	uint64_t PermissionEvaluator::getRolesHash(const Jsonifier::Vector<Snowflake>& roles) {
+		uint64_t hash{ roles.size() };
+		for (auto& value: roles) {
+			hash += KeyHasher{}(value);
 		}
+		return hash;
+	}
 
-		if (permissions & static_cast<uint64_t>(Permission::Administrator)) {
-			return getAllPermissions();
+	Snowflake PermissionEvaluator::getGuildOwnerId(Snowflake guildId) {
+		Snowflake ownerId{};
+		if (!Guilds::getCache().visit(guildId, [&](const GuildCacheData& guild) {
+				ownerId = guild.ownerId;
+			})) {
+			ownerId = Guilds::getCachedGuild({ .guildId = guildId }).ownerId;
 		}
+		return ownerId;
+	}
 
-		return std::to_string(permissions);
+	/// The @everyone Role shares its id with the Guild, so it can be looked up directly rather than by scanning the Guild's roles.
+	uint64_t PermissionEvaluator::getRolePermissions(Snowflake guildId, Snowflake roleId) {
+		uint64_t permissions{};
+		if (!Roles::getCache().visit(roleId, [&](const RoleCacheData& role) {
+				permissions = role.permissions.operator int64_t();
+			})) {
+			permissions = Roles::getCachedRole({ .guildId = guildId, .roleId = roleId }).permissions.operator int64_t();
+		}
+		return permissions;
 	}
 
+	UnorderedMap<uint64_t, UnorderedMap<uint64_t, PermissionEvaluator::MemoEntry>> PermissionEvaluator::memo{};
+	UnorderedMap<uint64_t, uint64_t> PermissionEvaluator::generations{};
+	std::shared_mutex PermissionEvaluator::memoMutex{};
+	bool PermissionEvaluator::doWeMemoize{};
+
 	std::string constructMultiPartData(const std::string& data, const Jsonifier::Vector<File>& files) {
 		const std::string boundary("boundary25");
 		const std::string partStart("--" + boundary + "\r\nContent-Type: application/octet-stream\r\nContent-Disposition: form-data; ");
@@ -70,6 +70,8 @@ namespace Jsonifier {
 
 namespace DiscordCoreAPI {
 
+	extern VoiceSendScheduler voiceSendScheduler;
+
 	VoiceUser::VoiceUser(Snowflake userIdNew) {
 		userId = userIdNew;
 	}
@@ -662,202 +664,266 @@ namespace DiscordCoreAPI {
 
 	CoRoutine<void, false> VoiceConnection::runVoice() {
 		token = co_await NewThreadAwaitable<void, false>();
-		StopWatch<std::chrono::milliseconds> stopWatch{ 20000ms };
-		StopWatch<std::chrono::milliseconds> sendSilenceStopWatch{ 5000ms };
-		while (!token.promise().areWeStopped() && !doWeQuit->load(std::memory_order_acquire) && activeState.load(std::memory_order_acquire) != VoiceActiveState::Exiting) {
+		while (!token.promise().areWeStopped() && !doWeQuit->load(std::memory_order_acquire) &&
+			activeState.load(std::memory_order_acquire) == VoiceActiveState::Connecting) {
 			try {
-				switch (activeState.load(std::memory_order_acquire)) {
-					case VoiceActiveState::Connecting: {
-						sendSpeakingMessage(false);
-						connectInternal();
-						sendSpeakingMessage(true);
-						break;
-					}
-					case VoiceActiveState::Stopped: {
-						sendSpeakingMessage(false);
+				sendSpeakingMessage(false);
+				connectInternal();
+				sendSpeakingMessage(true);
+			} catch (const DCAException& error) {
+				MessagePrinter::printError<PrintMessageType::WebSocket>(error.what());
+			}
+			if (activeState.load(std::memory_order_acquire) == VoiceActiveState::Connecting) {
+				std::this_thread::sleep_for(1ms);
+			}
+		}
+		if (!token.promise().areWeStopped() && !doWeQuit->load(std::memory_order_acquire) && activeState.load(std::memory_order_acquire) != VoiceActiveState::Exiting) {
+			lastTickState = VoiceActiveState::Connecting;
+			voiceSendScheduler.addConnection(this);
+		}
+		co_return;
+	};
+
+	void VoiceConnection::sendNextFrame() {
+		static constexpr uint64_t bytesPerSample{ 4 };
+		SongAPI& songAPI{ discordCoreClient->getSongAPI(voiceConnectInitData.guildId) };
+		if (songAPI.audioDataBuffer.tryReceive(xferAudioData)) {
+			songAPI.notifyQueueSpace();
+		}
+		if ((doWeSkip.load(std::memory_order_acquire) && xferAudioData.currentSize == 0)) {
+			skipInternal();
+		}
+
+		AudioFrameType frameType{ xferAudioData.type };
+		uint64_t frameSize{};
+		if (xferAudioData.currentSize <= 0) {
+			xferAudioData.clearData();
+		} else if (xferAudioData.type == AudioFrameType::RawPCM) {
+			uint64_t framesPerSecond = 1000 / msPerPacket;
+			frameSize				 = std::min(bytesPerSample * static_cast<uint64_t>(sampleRatePerSecond) / framesPerSecond, static_cast<uint64_t>(xferAudioData.currentSize));
+		}
+		std::basic_string_view<uint8_t> frame{};
+		switch (frameType) {
+			case AudioFrameType::RawPCM: {
+				auto encodedFrameData = encoder.encodeData(std::basic_string_view<uint8_t>(xferAudioData.data.data(), frameSize));
+				xferAudioData.clearData();
+				if (encodedFrameData.data.size() != 0) {
+					frame = packetEncrypter.encryptPacket(encodedFrameData);
+				}
+				break;
+			}
+			case AudioFrameType::Encoded: {
+				try {
+					DiscordCoreInternal::EncoderReturnData returnData{};
+					returnData.data		   = { xferAudioData.data.data(), static_cast<uint64_t>(xferAudioData.currentSize) };
+					returnData.sampleCount = 960;
+					if (returnData.data.size() != 0) {
+						frame = packetEncrypter.encryptPacket(returnData);
 						xferAudioData.clearData();
-						while (!token.promise().areWeStopped() && activeState.load(std::memory_order_acquire) == VoiceActiveState::Stopped) {
-							if (udpConnection.processIO() != DiscordCoreInternal::ConnectionStatus::NO_Error) {
-								++currentReconnectTries;
-								onClosed();
-							}
-							std::this_thread::sleep_for(1ms);
-							if (!token.promise().areWeStopped() && VoiceConnection::areWeConnected()) {
-								if (WebSocketCore::tcpConnection.processIO(10) != DiscordCoreInternal::ConnectionStatus::NO_Error) {
-									++currentReconnectTries;
-									onClosed();
-								}
-							}
+					}
+				} catch (const DCAException& error) {
+					MessagePrinter::printError<PrintMessageType::WebSocket>(error.what());
+					break;
+				}
+				break;
+			}
+			case AudioFrameType::Unset: {
+				xferAudioData.clearData();
+				break;
+			}
+		}
+		if (udpConnection.areWeStillConnected()) {
+			udpConnection.writeData(frame);
+			if (udpConnection.processIO() != DiscordCoreInternal::ConnectionStatus::NO_Error) {
+				++currentReconnectTries;
+				onClosed();
+				return;
+			}
+		} else {
+			xferAudioData.clearData();
+			onClosed();
+			return;
+		}
+
+		if (streamSocket) {
+			streamSocket->mixAudio();
+			if (!streamSocket->areWeStillConnected() || streamSocket->processIO() != DiscordCoreInternal::ConnectionStatus::NO_Error) {
+				++currentReconnectTries;
+				onClosed();
+			}
+		}
+	}
+
+	bool VoiceConnection::processTick() {
+		if (token.promise().areWeStopped() || doWeQuit->load(std::memory_order_acquire)) {
+			return false;
+		}
+		VoiceActiveState currentActiveState{ activeState.load(std::memory_order_acquire) };
+		try {
+			switch (currentActiveState) {
+				case VoiceActiveState::Connecting: {
+					connect(voiceConnectInitData);
+					return false;
+				}
+				case VoiceActiveState::Exiting: {
+					return false;
+				}
+				case VoiceActiveState::Stopped: {
+					[[fallthrough]];
+				}
+				case VoiceActiveState::Paused: {
+					if (lastTickState != currentActiveState) {
+						if (currentActiveState == VoiceActiveState::Stopped) {
+							sendSpeakingMessage(false);
+							xferAudioData.clearData();
+						} else {
 							sendSilence();
-							if (!token.promise().areWeStopped() && VoiceConnection::areWeConnected()) {
-								checkForAndSendHeartBeat(false);
-							}
 						}
+					}
+					if (udpConnection.processIO() != DiscordCoreInternal::ConnectionStatus::NO_Error) {
+						++currentReconnectTries;
+						onClosed();
 						break;
 					}
-					case VoiceActiveState::Paused: {
-						while (!token.promise().areWeStopped() && activeState.load(std::memory_order_acquire) == VoiceActiveState::Paused) {
-							if (udpConnection.processIO() != DiscordCoreInternal::ConnectionStatus::NO_Error) {
-								++currentReconnectTries;
-								onClosed();
-							}
-							std::this_thread::sleep_for(1ms);
-							if (!token.promise().areWeStopped() && VoiceConnection::areWeConnected()) {
-								if (WebSocketCore::tcpConnection.processIO(10) != DiscordCoreInternal::ConnectionStatus::NO_Error) {
-									++currentReconnectTries;
-									onClosed();
-								}
-							}
-							sendSilence();
-							if (!token.promise().areWeStopped() && VoiceConnection::areWeConnected()) {
-								checkForAndSendHeartBeat(false);
-							}
+					if (VoiceConnection::areWeConnected()) {
+						if (WebSocketCore::tcpConnection.processIO(0) != DiscordCoreInternal::ConnectionStatus::NO_Error) {
+							++currentReconnectTries;
+							onClosed();
+							break;
 						}
-						break;
+						checkForAndSendHeartBeat(false);
 					}
-					case VoiceActiveState::Playing: {
+					break;
+				}
+				case VoiceActiveState::Playing: {
+					if (lastTickState != currentActiveState) {
 						sendSpeakingMessage(false);
 						sendSpeakingMessage(true);
 						xferAudioData.clearData();
-
-						stopWatch.resetTimer();
-						while (!token.promise().areWeStopped() && (!udpConnection.areWeStillConnected())) {
-							if (stopWatch.hasTimePassed() || activeState.load(std::memory_order_acquire) == VoiceActiveState::Exiting) {
-								co_return;
-							}
-							std::this_thread::sleep_for(1ms);
-							if (!token.promise().areWeStopped() && VoiceConnection::areWeConnected()) {
-								if (WebSocketCore::tcpConnection.processIO(10) != DiscordCoreInternal::ConnectionStatus::NO_Error) {
-									++currentReconnectTries;
-									onClosed();
-								}
-							}
-							if (!token.promise().areWeStopped() && VoiceConnection::areWeConnected()) {
-								checkForAndSendHeartBeat(false);
-							}
-						}
-
-						auto targetTime{ HRClock::now() + intervalCount };
-
-						while (!token.promise().areWeStopped() && activeState.load(std::memory_order_acquire) == VoiceActiveState::Playing) {
-							uint64_t bytesPerSample{ 4 };
-							if (!token.promise().areWeStopped() && VoiceConnection::areWeConnected()) {
-								checkForAndSendHeartBeat(false);
-							}
-							discordCoreClient->getSongAPI(voiceConnectInitData.guildId).audioDataBuffer.tryReceive(xferAudioData);
-							if ((doWeSkip.load(std::memory_order_acquire) && xferAudioData.currentSize == 0)) {
-								skipInternal();
-							}
-
-							AudioFrameType frameType{ xferAudioData.type };
-							uint64_t frameSize{};
-							if (xferAudioData.currentSize <= 0) {
-								xferAudioData.clearData();
-							} else if (xferAudioData.type == AudioFrameType::RawPCM) {
-								intervalCount			 = Nanoseconds{ static_cast<uint64_t>(static_cast<double>(xferAudioData.currentSize / bytesPerSample) /
-									   static_cast<double>(sampleRatePerSecond) * static_cast<double>(nsPerSecond)) };
-								uint64_t framesPerSecond = 1000 / msPerPacket;
-								frameSize				 = std::min(bytesPerSample * static_cast<uint64_t>(sampleRatePerSecond) / framesPerSecond, xferAudioData.data.size());
-							} else {
-								intervalCount = Nanoseconds{ 20000000 };
-							}
-							std::basic_string_view<uint8_t> frame{};
-							switch (frameType) {
-								case AudioFrameType::RawPCM: {
-									auto encodedFrameData = encoder.encodeData(std::basic_string_view<uint8_t>(xferAudioData.data.data(), frameSize));
-									xferAudioData.clearData();
-									if (encodedFrameData.data.size() != 0) {
-										frame = packetEncrypter.encryptPacket(encodedFrameData);
-									}
-									break;
-								}
-								case AudioFrameType::Encoded: {
-									try {
-										DiscordCoreInternal::EncoderReturnData returnData{};
-										returnData.data		   = { xferAudioData.data.data(), static_cast<uint64_t>(xferAudioData.currentSize) };
-										returnData.sampleCount = 960;
-										if (returnData.data.size() != 0) {
-											frame = packetEncrypter.encryptPacket(returnData);
-											xferAudioData.clearData();
-										}
-									} catch (const DCAException& error) {
-										MessagePrinter::printError<PrintMessageType::WebSocket>(error.what());
-										break;
-									}
-									break;
-								}
-								case AudioFrameType::Unset: {
-									xferAudioData.clearData();
-									break;
-								}
-							}
-							auto waitTime	   = targetTime - HRClock::now();
-							auto waitTimeCount = waitTime.count();
-							int64_t minimumFreeTimeForCheckingProcessIO{ static_cast<int64_t>(static_cast<double>(intervalCount.count()) * 0.60l) };
-							if (VoiceConnection::areWeConnected()) {
-								if (waitTimeCount >= minimumFreeTimeForCheckingProcessIO && !token.promise().areWeStopped()) {
-									if (WebSocketCore::tcpConnection.processIO(0) != DiscordCoreInternal::ConnectionStatus::NO_Error) {
-										++currentReconnectTries;
-										onClosed();
-									}
-								}
-
-							} else {
-								onClosed();
-							}
-
-							waitTime	  = targetTime - HRClock::now();
-							waitTimeCount = static_cast<int64_t>(static_cast<double>(waitTime.count()) * 0.85l);
-							if (waitTimeCount > 0) {
-								nanoSleep(waitTimeCount);
-							}
-							waitTime	  = targetTime - HRClock::now();
-							waitTimeCount = waitTime.count();
-							if (waitTimeCount > 0 && waitTimeCount < intervalCount.count()) {
-								spinLock(waitTimeCount);
-							}
-							if (udpConnection.areWeStillConnected()) {
-								udpConnection.writeData(frame);
-								if (udpConnection.processIO() != DiscordCoreInternal::ConnectionStatus::NO_Error) {
-									++currentReconnectTries;
-									onClosed();
-								}
-							} else {
-								xferAudioData.clearData();
-								onClosed();
-							}
-
-							targetTime = HRClock::now() + intervalCount;
-
-							if (streamSocket) {
-								streamSocket->mixAudio();
-								if (streamSocket->areWeStillConnected()) {
-									if (streamSocket->processIO() != DiscordCoreInternal::ConnectionStatus::NO_Error) {
-										++currentReconnectTries;
-										std::this_thread::sleep_for(5s);
-										onClosed();
-									}
-								} else {
-									std::this_thread::sleep_for(5s);
-									onClosed();
-								}
-							}
-						}
+					}
+					if (!VoiceConnection::areWeConnected()) {
+						onClosed();
 						break;
 					}
-					case VoiceActiveState::Exiting: {
-						co_return;
+					checkForAndSendHeartBeat(false);
+					sendNextFrame();
+					if (VoiceConnection::areWeConnected() && WebSocketCore::tcpConnection.processIO(0) != DiscordCoreInternal::ConnectionStatus::NO_Error) {
+						++currentReconnectTries;
+						onClosed();
 					}
+					break;
 				}
-				if (token.promise().areWeStopped() || activeState == VoiceActiveState::Exiting) {
-					co_return;
+			}
+		} catch (const DCAException& error) {
+			MessagePrinter::printError<PrintMessageType::WebSocket>(error.what());
+		}
+		lastTickState = currentActiveState;
+		return true;
+	}
+
+	VoiceSendScheduler::VoiceSendScheduler() {
+		uint64_t threadCount{ std::max<uint64_t>(DiscordCoreInternal::ThreadWrapper::hardware_concurrency(), 1) };
+		for (uint64_t x = 0; x < threadCount; ++x) {
+			workers.emplace_back(makeUnique<Worker>());
+		}
+	}
+
+	VoiceSendScheduler::Worker& VoiceSendScheduler::getWorker(VoiceConnection* connection) {
+		return *workers[(connection->voiceConnectInitData.guildId.operator const uint64_t&() >> 22) % workers.size()];
+	}
+
+	void VoiceSendScheduler::addConnection(VoiceConnection* connection) {
+		Worker& worker{ getWorker(connection) };
+		std::unique_lock lock{ worker.accessMutex };
+		connection->areWeScheduled.store(true, std::memory_order_release);
+		if (std::find(worker.connections.begin(), worker.connections.end(), connection) == worker.connections.end()) {
+			worker.connections.emplace_back(connection);
+		}
+		if (!worker.thread.joinable()) {
+			worker.thread = DiscordCoreInternal::ThreadWrapper([&, this](DiscordCoreInternal::StopToken stopToken) {
+				run(stopToken, worker);
+			});
+		}
+		lock.unlock();
+		worker.condition.notify_one();
+	}
+
+	void VoiceSendScheduler::removeConnection(VoiceConnection* connection) {
+		Worker& worker{ getWorker(connection) };
+		connection->areWeScheduled.store(false, std::memory_order_release);
+		if (std::this_thread::get_id() == worker.threadId.load(std::memory_order_acquire)) {
+			return;
+		}
+		std::unique_lock lock{ worker.accessMutex };
+		for (uint64_t x = 0; x < worker.connections.size(); ++x) {
+			if (worker.connections[x] == connection) {
+				worker.connections.erase(worker.connections.begin() + static_cast<int64_t>(x));
+				break;
+			}
+		}
+		worker.tickCondition.wait(lock, [&] {
+			return worker.currentConnection != connection;
+		});
+	}
+
+	void VoiceSendScheduler::run(DiscordCoreInternal::StopToken stopToken, Worker& worker) {
+		std::unique_lock lock{ worker.accessMutex };
+		worker.threadId.store(std::this_thread::get_id(), std::memory_order_release);
+		Jsonifier::Vector<VoiceConnection*> connections{};
+		auto nextTick = HRClock::now();
+		while (!stopToken.stopRequested()) {
+			if (worker.connections.empty()) {
+				worker.condition.wait(lock, [&] {
+					return !worker.connections.empty() || stopToken.stopRequested();
+				});
+				nextTick = HRClock::now();
+				continue;
+			}
+			// Ticks run on a copy of the list and outside the lock, so that adding or removing a connection never waits on a whole tick.
+			connections = worker.connections;
+			for (auto& connection: connections) {
+				if (std::find(worker.connections.begin(), worker.connections.end(), connection) == worker.connections.end()) {
+					continue;
 				}
-				std::this_thread::sleep_for(1ms);
-			} catch (const DCAException& error) {
-				MessagePrinter::printError<PrintMessageType::WebSocket>(error.what());
+				bool doWeKeep{ connection->areWeScheduled.load(std::memory_order_acquire) };
+				if (doWeKeep) {
+					worker.currentConnection = connection;
+					lock.unlock();
+					doWeKeep = connection->processTick() && connection->areWeScheduled.load(std::memory_order_acquire);
+					lock.lock();
+					worker.currentConnection = nullptr;
+					worker.tickCondition.notify_all();
+				}
+				if (!doWeKeep) {
+					connection->areWeScheduled.store(false, std::memory_order_release);
+					auto iter = std::find(worker.connections.begin(), worker.connections.end(), connection);
+					if (iter != worker.connections.end()) {
+						worker.connections.erase(iter);
+					}
+				}
+			}
+			nextTick += tickInterval;
+			auto currentTime = HRClock::now();
+			if (nextTick < currentTime) {
+				nextTick = currentTime;
 			}
+			worker.condition.wait_until(lock, nextTick, [&] {
+				return stopToken.stopRequested();
+			});
 		}
-	};
+	}
+
+	VoiceSendScheduler::~VoiceSendScheduler() {
+		for (auto& value: workers) {
+			value->thread.requestStop();
+			std::unique_lock lock{ value->accessMutex };
+			lock.unlock();
+			value->condition.notify_all();
+			if (value->thread.joinable()) {
+				value->thread.join();
+			}
+		}
+	}
 
 	void VoiceConnection::skipInternal(uint32_t currentRecursionDepth) {
 		if (currentRecursionDepth >= 10) {
@@ -991,6 +1057,7 @@ namespace DiscordCoreAPI {
 
 	void VoiceConnection::disconnect() {
 		activeState.store(VoiceActiveState::Exiting, std::memory_order_release);
+		voiceSendScheduler.removeConnection(this);
 		if (taskThread.getStatus() == CoRoutineStatus::Running) {
 			taskThread.cancel();
 		}
@@ -1008,6 +1075,7 @@ namespace DiscordCoreAPI {
 		connectionState.store(VoiceConnectionState::Collecting_Init_Data, std::memory_order_release);
 		currentState.store(DiscordCoreInternal::WebSocketState::Disconnected, std::memory_order_release);
 		discordCoreClient->getSongAPI(voiceConnectInitData.guildId).audioDataBuffer.clearContents();
+		discordCoreClient->getSongAPI(voiceConnectInitData.guildId).notifyQueueSpace();
 	}
 
 	void VoiceConnection::onClosed() {
@@ -44,140 +44,22 @@ namespace DiscordCoreAPI {
 		constexpr uint8_t maxHeaderSize{ sizeof(uint64_t) + 2u };
 		constexpr uint8_t webSocketMaxPayloadLengthSmall{ 125u };
 		constexpr uint8_t webSocketMaskBit{ (1u << 7u) };
+		constexpr uint8_t webSocketFinishBit{ (1u << 7u) };
+		constexpr uint8_t webSocketOpCodeMask{ 0x0fu };
+		constexpr uint8_t webSocketMaskKeySize{ 4u };
 
-		EventConverter::EventConverter(std::string newEvent) {
+		EventConverter::EventConverter(std::string_view newEvent) {
 			eventValue = newEvent;
-			for (uint64_t x = 0; x < eventValue.size(); ++x) {
-				if (eventValue.at(x) == '\0') {
-					eventValue.erase(eventValue.begin() + x);
-				}
+			if (eventValue.find('\0') != std::string_view::npos) {
+				eventStorage = newEvent;
+				std::erase(eventStorage, '\0');
+				eventValue = eventStorage;
 			}
 		}
 
 		EventConverter::operator uint64_t() {
-			if (eventValue == "READY") {
-				return 1;
-			} else if (eventValue == "RESUMED") {
-				return 2;
-			} else if (eventValue == "APPLICATION_COMMAND_PERMISSIONS_UPDATE") {
-				return 3;
-			} else if (eventValue == "AUTO_MODERATION_RULE_CREATE") {
-				return 4;
-			} else if (eventValue == "AUTO_MODERATION_RULE_UPDATE") {
-				return 5;
-			} else if (eventValue == "AUTO_MODERATION_RULE_DELETE") {
-				return 6;
-			} else if (eventValue == "AUTO_MODERATION_ACTION_EXECUTION") {
-				return 7;
-			} else if (eventValue == "CHANNEL_CREATE") {
-				return 8;
-			} else if (eventValue == "CHANNEL_UPDATE") {
-				return 9;
-			} else if (eventValue == "CHANNEL_DELETE") {
-				return 10;
-			} else if (eventValue == "CHANNEL_PINS_UPDATE") {
-				return 11;
-			} else if (eventValue == "THREAD_CREATE") {
-				return 12;
-			} else if (eventValue == "THREAD_UPDATE") {
-				return 13;
-			} else if (eventValue == "THREAD_DELETE") {
-				return 14;
-			} else if (eventValue == "THREAD_LIST_SYNC") {
-				return 15;
-			} else if (eventValue == "THREAD_MEMBER_UPDATE") {
-				return 16;
-			} else if (eventValue == "THREAD_MEMBERS_UPDATE") {
-				return 17;
-			} else if (eventValue == "GUILD_CREATE") {
-				return 18;
-			} else if (eventValue == "GUILD_UPDATE") {
-				return 19;
-			} else if (eventValue == "GUILD_DELETE") {
-				return 20;
-			} else if (eventValue == "GUILD_BAN_ADD") {
-				return 21;
-			} else if (eventValue == "GUILD_BAN_REMOVE") {
-				return 22;
-			} else if (eventValue == "GUILD_EMOJIS_UPDATE") {
-				return 23;
-			} else if (eventValue == "GUILD_STICKERS_UPDATE") {
-				return 24;
-			} else if (eventValue == "GUILD_INTEGRATIONS_UPDATE") {
-				return 25;
-			} else if (eventValue == "GUILD_MEMBER_ADD") {
-				return 26;
-			} else if (eventValue == "GUILD_MEMBER_REMOVE") {
-				return 27;
-			} else if (eventValue == "GUILD_MEMBER_UPDATE") {
-				return 28;
-			} else if (eventValue == "GUILD_MEMBERS_CHUNK") {
-				return 29;
-			} else if (eventValue == "GUILD_ROLE_CREATE") {
-				return 30;
-			} else if (eventValue == "GUILD_ROLE_UPDATE") {
-				return 31;
-			} else if (eventValue == "GUILD_ROLE_DELETE") {
-				return 32;
-			} else if (eventValue == "GUILD_SCHEDULED_EVENT_CREATE") {
-				return 33;
-			} else if (eventValue == "GUILD_SCHEDULED_EVENT_UPDATE") {
-				return 34;
-			} else if (eventValue == "GUILD_SCHEDULED_EVENT_DELETE") {
-				return 35;
-			} else if (eventValue == "GUILD_SCHEDULED_EVENT_USER_ADD") {
-				return 36;
-			} else if (eventValue == "GUILD_SCHEDULED_EVENT_USER_REMOVE") {
-				return 37;
-			} else if (eventValue == "INTEGRATION_CREATE") {
-				return 38;
-			} else if (eventValue == "INTEGRATION_UPDATE") {
-				return 39;
-			} else if (eventValue == "INTEGRATION_DELETE") {
-				return 40;
-			} else if (eventValue == "INTERACTION_CREATE") {
-				return 41;
-			} else if (eventValue == "INVITE_CREATE") {
-				return 42;
-			} else if (eventValue == "INVITE_DELETE") {
-				return 43;
-			} else if (eventValue == "MESSAGE_CREATE") {
-				return 44;
-			} else if (eventValue == "MESSAGE_UPDATE") {
-				return 45;
-			} else if (eventValue == "MESSAGE_DELETE") {
-				return 46;
-			} else if (eventValue == "MESSAGE_DELETE_BULK") {
-				return 47;
-			} else if (eventValue == "MESSAGE_REACTION_ADD") {
-				return 48;
-			} else if (eventValue == "MESSAGE_REACTION_REMOVE") {
-				return 49;
-			} else if (eventValue == "MESSAGE_REACTION_REMOVE_ALL") {
-				return 50;
-			} else if (eventValue == "MESSAGE_REACTION_REMOVE_EMOJI") {
-				return 51;
-			} else if (eventValue == "PRESENCE_UPDATE") {
-				return 52;
-			} else if (eventValue == "STAGE_INSTANCE_CREATE") {
-				return 53;
-			} else if (eventValue == "STAGE_INSTANCE_UPDATE") {
-				return 54;
-			} else if (eventValue == "STAGE_INSTANCE_DELETE") {
-				return 55;
-			} else if (eventValue == "TYPING_START") {
-				return 56;
-			} else if (eventValue == "USER_UPDATE") {
-				return 57;
-			} else if (eventValue == "VOICE_STATE_UPDATE") {
-				return 58;
-			} else if (eventValue == "VOICE_SERVER_UPDATE") {
-				return 59;
-			} else if (eventValue == "WEBHOOKS_UPDATE") {
-				return 60;
-			} else {
-				return 0;
-			}
+			uint8_t index = eventTable[hashEventName(eventValue, eventSeed) & (eventTableSize - 1)];
+			return eventNames[index] == eventValue ? index : 0;
 		}
 
 		WebSocketCore::WebSocketCore(ConfigManager* configManagerNew, WebSocketType typeOfWebSocketNew) : EtfParser{} {
@@ -191,6 +73,10 @@ namespace DiscordCoreAPI {
 			heartBeatStopWatch		   = std::move(other.heartBeatStopWatch);
 			haveWeReceivedHeartbeatAck = other.haveWeReceivedHeartbeatAck;
 			currentMessage			   = std::move(other.currentMessage);
+			fragmentBuffer			   = std::move(other.fragmentBuffer);
+			fragmentOpCode			   = other.fragmentOpCode;
+			inflater				   = std::move(other.inflater);
+			doWeInflate				   = other.doWeInflate;
 			tcpConnection			   = std::move(other.tcpConnection);
 			finalString				   = std::move(other.finalString);
 			currentReconnectTries	   = other.currentReconnectTries;
@@ -215,6 +101,12 @@ namespace DiscordCoreAPI {
 		}
 
 		bool WebSocketCore::connect(const std::string& baseUrlNew, const std::string& relativePath, const uint16_t portNew) {
+			currentMessage.clear();
+			fragmentBuffer.clear();
+			fragmentOpCode = WebSocketOpCode::Op_Continuation;
+			if (doWeInflate) {
+				inflater.reset();
+			}
 			tcpConnection = WebSocketTCPConnection{ baseUrlNew, portNew, this };
 			if (tcpConnection.currentStatus != ConnectionStatus::NO_Error) {
 				std::this_thread::sleep_for(1s);
@@ -298,7 +190,7 @@ namespace DiscordCoreAPI {
 			if (areWeConnected() && currentState.load(std::memory_order_acquire) == WebSocketState::Upgrading) {
 				auto theFindValue = currentMessage.operator std::string_view().find("\r\n\r\n");
 				if (theFindValue != std::string::npos) {
-					currentMessage.clear();
+					currentMessage.erase(theFindValue + 4);
 					currentState.store(WebSocketState::Collecting_Hello, std::memory_order_release);
 					return;
 				}
@@ -328,81 +220,141 @@ namespace DiscordCoreAPI {
 			return false;
 		}
 
-		bool WebSocketCore::parseMessage() {
-			if (currentMessage.size() < 4) {
-				return false;
-			} else {
-				WebSocketOpCode opcode = static_cast<WebSocketOpCode>(currentMessage[0] & ~webSocketMaskBit);
-				switch (opcode) {
-					case WebSocketOpCode::Op_Continuation:
-					case WebSocketOpCode::Op_Text:
-					case WebSocketOpCode::Op_Binary:
-					case WebSocketOpCode::Op_Ping:
-					case WebSocketOpCode::Op_Pong: {
-						uint8_t length00	   = currentMessage[1];
-						uint32_t messageOffset = 2;
-
-						if (length00 & webSocketMaskBit) {
-							return true;
-						}
-
-						uint64_t lengthFinal = length00;
-
-						if (length00 == webSocketPayloadLengthMagicLarge) {
-							if (currentMessage.size() < 8) {
-								return false;
-							}
-
-							uint8_t length01 = static_cast<uint8_t>(currentMessage[2]);
-							uint8_t length02 = static_cast<uint8_t>(currentMessage[3]);
-							lengthFinal		 = static_cast<uint64_t>((length01 << 8ull) | length02);
-
-							messageOffset += 2;
-						} else if (length00 == webSocketPayloadLengthMagicHuge) {
-							if (currentMessage.size() < 10) {
-								return false;
-							}
-							lengthFinal = 0;
-							for (uint64_t x = 2, shift = 56; x < 10; ++x, shift -= 8) {
-								uint8_t length03 = static_cast<uint8_t>(currentMessage[x]);
-								lengthFinal |= static_cast<uint64_t>(length03 & 0xff) << shift;
-							}
-							messageOffset += 8;
-						}
+		uint64_t WebSocketCore::getFrameSize(std::string_view data) {
+			if (data.size() < 2) {
+				return 2;
+			}
+			uint8_t length00{ static_cast<uint8_t>(static_cast<uint8_t>(data[1]) & ~webSocketMaskBit) };
+			uint64_t headerSize{ 2ull + (static_cast<uint8_t>(data[1]) & webSocketMaskBit ? webSocketMaskKeySize : 0ull) };
+			uint64_t lengthFinal{ length00 };
+			if (length00 == webSocketPayloadLengthMagicLarge) {
+				headerSize += 2;
+				if (data.size() < headerSize) {
+					return headerSize;
+				}
+				lengthFinal = (static_cast<uint64_t>(static_cast<uint8_t>(data[2])) << 8ull) | static_cast<uint8_t>(data[3]);
+			} else if (length00 == webSocketPayloadLengthMagicHuge) {
+				headerSize += 8;
+				if (data.size() < headerSize) {
+					return headerSize;
+				}
+				lengthFinal = 0;
+				for (uint64_t x = 2, shift = 56; x < 10; ++x, shift -= 8) {
+					lengthFinal |= static_cast<uint64_t>(static_cast<uint8_t>(data[x])) << shift;
+				}
+			}
+			return headerSize + lengthFinal;
+		}
 
-						if (currentMessage.size() < messageOffset + lengthFinal) {
-							return false;
-						}
+		bool WebSocketCore::processFrames(std::string_view chunk) {
+			// A frame split across reads is topped up with exactly the bytes it still lacks, so it never holds the start of the next one.
+			while (currentMessage.size() > 0) {
+				uint64_t frameSize{ getFrameSize(currentMessage.operator std::string_view()) };
+				if (currentMessage.size() < frameSize) {
+					uint64_t bytesToCopy{ std::min<uint64_t>(frameSize - currentMessage.size(), chunk.size()) };
+					if (bytesToCopy == 0) {
+						return true;
+					}
+					auto oldSize = currentMessage.size();
+					currentMessage.resize(oldSize + bytesToCopy);
+					std::memcpy(currentMessage.data() + oldSize, chunk.data(), bytesToCopy);
+					chunk.remove_prefix(bytesToCopy);
+					continue;
+				}
+				bool doWeContinue{ handleFrame(currentMessage.operator std::string_view()) };
+				currentMessage.clear();
+				if (!doWeContinue) {
+					return false;
+				}
+			}
+			while (chunk.size() > 0) {
+				uint64_t frameSize{ getFrameSize(chunk) };
+				if (chunk.size() < frameSize) {
+					currentMessage.resize(chunk.size());
+					std::memcpy(currentMessage.data(), chunk.data(), chunk.size());
+					return true;
+				}
+				if (!handleFrame(chunk.substr(0, frameSize))) {
+					return false;
+				}
+				chunk.remove_prefix(frameSize);
+			}
+			return true;
+		}
 
-						if (opcode == WebSocketOpCode::Op_Ping || opcode == WebSocketOpCode::Op_Pong) {
-							return false;
-						} else {
-							onMessageReceived({ currentMessage.data() + messageOffset, lengthFinal });
-							currentMessage.erase(messageOffset + lengthFinal);
-						}
+		bool WebSocketCore::handleFrame(std::string_view frame) {
+			uint8_t byte00{ static_cast<uint8_t>(frame[0]) };
+			uint8_t byte01{ static_cast<uint8_t>(frame[1]) };
+			std::string webSocketTitle{ wsType == WebSocketType::Voice ? "Voice WebSocket" : "WebSocket" };
+			if (byte01 & webSocketMaskBit) {
+				MessagePrinter::printError<PrintMessageType::WebSocket>(webSocketTitle + " [" + std::to_string(shard[0]) + "," + std::to_string(shard[1]) + "]" +
+					" Received a masked frame from the server.");
+				fragmentBuffer.clear();
+				onClosed();
+				return false;
+			}
+			WebSocketOpCode opcode{ static_cast<WebSocketOpCode>(byte00 & webSocketOpCodeMask) };
+			bool isFinal{ (byte00 & webSocketFinishBit) != 0 };
+			uint8_t length00{ static_cast<uint8_t>(byte01 & ~webSocketMaskBit) };
+			uint64_t headerSize{ length00 == webSocketPayloadLengthMagicHuge ? 10ull : length00 == webSocketPayloadLengthMagicLarge ? 4ull : 2ull };
+			std::string_view payload{ frame.substr(headerSize) };
+			switch (opcode) {
+				case WebSocketOpCode::Op_Text:
+				case WebSocketOpCode::Op_Binary: {
+					if (!isFinal) {
+						fragmentOpCode = opcode;
+						fragmentBuffer.resize(payload.size());
+						std::memcpy(fragmentBuffer.data(), payload.data(), payload.size());
 						return true;
-					} break;
-					case WebSocketOpCode::Op_Close: {
-						uint16_t closeValue = currentMessage[2] & 0xff;
-						closeValue <<= 8;
-						closeValue |= currentMessage[3] & 0xff;
-						std::string closeString{};
-						if (wsType == WebSocketType::Voice) {
-							VoiceWebSocketClose voiceClose{ closeValue };
-							closeString = voiceClose.operator std::string_view();
-						} else {
-							WebSocketClose wsClose{ closeValue };
-							closeString = wsClose.operator std::string_view();
-						}
-						std::string webSocketTitle = wsType == WebSocketType::Voice ? "Voice WebSocket" : "WebSocket";
+					}
+					onMessageReceived(payload);
+					return areWeConnected();
+				}
+				case WebSocketOpCode::Op_Continuation: {
+					if (fragmentOpCode == WebSocketOpCode::Op_Continuation) {
 						MessagePrinter::printError<PrintMessageType::WebSocket>(webSocketTitle + " [" + std::to_string(shard[0]) + "," + std::to_string(shard[1]) + "]" +
-							" Closed; Code: " + std::to_string(closeValue) + ", " + closeString);
-						return false;
-					} break;
-
-					default: {
-						return false;
-					} break;
+							" Received a continuation frame with no message to continue.");
+						return true;
+					}
+					auto oldSize = fragmentBuffer.size();
+					fragmentBuffer.resize(oldSize + payload.size());
+					std::memcpy(fragmentBuffer.data() + oldSize, payload.data(), payload.size());
+					if (!isFinal) {
+						return true;
+					}
+					onMessageReceived(fragmentBuffer.operator std::string_view());
+					fragmentBuffer.clear();
+					fragmentOpCode = WebSocketOpCode::Op_Continuation;
+					return areWeConnected();
+				}
+				case WebSocketOpCode::Op_Ping: {
+					std::string pongMessage{ payload };
+					createHeader(pongMessage, WebSocketOpCode::Op_Pong);
+					sendMessage(pongMessage, true);
+					return true;
+				}
+				case WebSocketOpCode::Op_Pong: {
+					return true;
+				}
+				case WebSocketOpCode::Op_Close: {
+					uint16_t closeValue{};
+					if (payload.size() >= 2) {
+						closeValue = static_cast<uint16_t>((static_cast<uint8_t>(payload[0]) << 8) | static_cast<uint8_t>(payload[1]));
+					}
+					std::string closeString{};
+					if (wsType == WebSocketType::Voice) {
+						VoiceWebSocketClose voiceClose{ closeValue };
+						closeString = voiceClose.operator std::string_view();
+					} else {
+						WebSocketClose wsClose{ closeValue };
+						closeString = wsClose.operator std::string_view();
+					}
+					MessagePrinter::printError<PrintMessageType::WebSocket>(webSocketTitle + " [" + std::to_string(shard[0]) + "," + std::to_string(shard[1]) + "]" +
+						" Closed; Code: " + std::to_string(closeValue) + ", " + closeString);
+					return false;
+				}
+				default: {
+					return false;
 				}
 			}
 		}
@@ -412,24 +364,23 @@ namespace DiscordCoreAPI {
 		}
 
 		void WebSocketTCPConnection::handleBuffer() {
+			auto inputBufferNew = getInputBuffer();
+			std::string_view chunk{ reinterpret_cast<const char*>(inputBufferNew.data()), inputBufferNew.size() };
 			if (ptr->currentState.load(std::memory_order_acquire) == WebSocketState::Upgrading) {
-				auto inputBufferNew = getInputBuffer();
-				auto oldSize		= ptr->currentMessage.size();
-				if (ptr->currentMessage.size() < oldSize + inputBufferNew.size()) {
-					ptr->currentMessage.resize(oldSize + inputBufferNew.size());
-				}
-				std::memcpy(ptr->currentMessage.data() + oldSize, inputBufferNew.data(), inputBufferNew.size());
+				auto oldSize = ptr->currentMessage.size();
+				ptr->currentMessage.resize(oldSize + chunk.size());
+				std::memcpy(ptr->currentMessage.data() + oldSize, chunk.data(), chunk.size());
 				ptr->parseConnectionHeaders();
-			} else {
-				auto inputBufferNew = getInputBuffer();
-				auto oldSize		= ptr->currentMessage.size();
-				if (ptr->currentMessage.size() < oldSize + inputBufferNew.size()) {
-					ptr->currentMessage.resize(oldSize + inputBufferNew.size());
+				if (ptr->currentState.load(std::memory_order_acquire) == WebSocketState::Upgrading) {
+					return;
 				}
-				std::memcpy(ptr->currentMessage.data() + oldSize, inputBufferNew.data(), inputBufferNew.size());
-				while (ptr->parseMessage()) {
-				};
+				// Whatever followed the upgrade response in this read is the start of the frame stream.
+				std::string remainder{ ptr->currentMessage.operator std::string_view() };
+				ptr->currentMessage.clear();
+				ptr->processFrames(remainder);
+				return;
 			}
+			ptr->processFrames(chunk);
 		}
 
 		WebSocketClient::WebSocketClient(DiscordCoreClient* client, uint32_t currentShardNew, std::atomic_bool* doWeQuitNew)
@@ -439,12 +390,44 @@ namespace DiscordCoreAPI {
 			discordCoreClient = client;
 			doWeQuit		  = doWeQuitNew;
 			if (discordCoreClient) {
+				auto addInterest = [&](std::initializer_list<uint64_t> eventIndices) {
+					for (auto& value: eventIndices) {
+						interestMask |= 1ull << value;
+					}
+				};
+				addInterest({ 1, 2, 41, 58, 59 });
+				if (configManager->doWeCacheChannels()) {
+					addInterest({ 8, 9, 10, 18, 20 });
+				}
+				if (configManager->doWeCacheGuilds()) {
+					addInterest({ 18, 19, 20 });
+				}
+				if (configManager->doWeCacheGuildMembers()) {
+					addInterest({ 18, 20, 26, 27, 28 });
+				}
+				if (configManager->doWeCacheRoles()) {
+					addInterest({ 18, 20, 30, 31, 32 });
+				}
+				if (configManager->doWeCacheUsers()) {
+					addInterest({ 18 });
+				}
+				if (configManager->doWeCachePermissions()) {
+					addInterest({ 9, 10, 19, 20, 27, 28, 31, 32 });
+				}
 				shard[1] = discordCoreClient->configManager.getTotalShardCount();
 				if (discordCoreClient->configManager.getTextFormat() == TextFormat::Etf) {
 					dataOpCode = WebSocketOpCode::Op_Binary;
 				} else {
 					dataOpCode = WebSocketOpCode::Op_Text;
 				}
+				if (discordCoreClient->configManager.getGatewayCompression() == GatewayCompression::Zlib_Stream) {
+					if (GatewayInflater::isItSupported()) {
+						doWeInflate = true;
+					} else {
+						MessagePrinter::printError<PrintMessageType::WebSocket>(
+							"WebSocketClient::WebSocketClient() Error: zlib-stream compression was requested, but the library was built without zlib - connecting uncompressed.");
+					}
+				}
 			}
 		}
 
@@ -504,22 +487,319 @@ namespace DiscordCoreAPI {
 			}
 		}
 
+		bool WebSocketClient::isEventWanted(uint64_t eventIndex) {
+			if (eventIndex >= eventNames.size()) {
+				return false;
+			} else if (interestMask & (1ull << eventIndex)) {
+				return true;
+			}
+			static constexpr std::array<bool (*)(DiscordCoreClient*), eventNames.size()> listenerTable{
+				[](DiscordCoreClient*) {
+					return false;
+				},
+				[](DiscordCoreClient*) {
+					return true;
+				},
+				[](DiscordCoreClient*) {
+					return true;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onApplicationCommandPermissionsUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onAutoModerationRuleCreationEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onAutoModerationRuleUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onAutoModerationRuleDeletionEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onAutoModerationActionExecutionEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onChannelCreationEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onChannelUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onChannelDeletionEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onChannelPinsUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onThreadCreationEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onThreadUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onThreadDeletionEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onThreadListSyncEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onThreadMemberUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onThreadMembersUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildCreationEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildDeletionEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildBanAddEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildBanRemoveEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildEmojisUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildStickersUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildIntegrationsUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildMemberAddEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildMemberRemoveEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildMemberUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildMembersChunkEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onRoleCreationEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onRoleUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onRoleDeletionEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildScheduledEventCreationEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildScheduledEventUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildScheduledEventDeletionEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildScheduledEventUserAddEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onGuildScheduledEventUserRemoveEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onIntegrationCreationEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onIntegrationUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onIntegrationDeletionEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onInteractionCreationEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onInviteCreationEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onInviteDeletionEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onMessageCreationEvent.functions.size() > 0 || MessageCollector::objectsBuffersMap.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onMessageUpdateEvent.functions.size() > 0 || MessageCollector::objectsBuffersMap.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onMessageDeletionEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onMessageDeleteBulkEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onReactionAddEvent.functions.size() > 0 || ReactionCollector::objectsBuffersMap.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onReactionRemoveEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onReactionRemoveAllEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onReactionRemoveEmojiEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onPresenceUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onStageInstanceCreationEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onStageInstanceUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onStageInstanceDeletionEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onTypingStartEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onUserUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onVoiceStateUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onVoiceServerUpdateEvent.functions.size() > 0;
+				},
+				[](DiscordCoreClient* client) {
+					return client->eventManager.onWebhookUpdateEvent.functions.size() > 0;
+				}
+			};
+			return listenerTable[eventIndex](discordCoreClient);
+		}
+
+		bool WebSocketClient::scanEnvelope(std::string_view dataNew, WebSocketMessage& message, std::string_view& payload) {
+			uint64_t index{};
+			auto skipWhiteSpace = [&]() {
+				while (index < dataNew.size() && (dataNew[index] == ' ' || dataNew[index] == '\t' || dataNew[index] == '\n' || dataNew[index] == '\r')) {
+					++index;
+				}
+			};
+			auto skipString = [&]() {
+				++index;
+				while (index < dataNew.size()) {
+					if (dataNew[index] == '\\') {
+						index += 2;
+					} else if (dataNew[index++] == '"') {
+						return true;
+					}
+				}
+				return false;
+			};
+			auto skipValue = [&]() {
+				if (dataNew[index] == '"') {
+					return skipString();
+				} else if (dataNew[index] == '{' || dataNew[index] == '[') {
+					uint64_t depth{};
+					while (index < dataNew.size()) {
+						if (dataNew[index] == '"') {
+							if (!skipString()) {
+								return false;
+							}
+							continue;
+						} else if (dataNew[index] == '{' || dataNew[index] == '[') {
+							++depth;
+						} else if (dataNew[index] == '}' || dataNew[index] == ']') {
+							--depth;
+						}
+						++index;
+						if (depth == 0) {
+							return true;
+						}
+					}
+					return false;
+				}
+				while (index < dataNew.size() && dataNew[index] != ',' && dataNew[index] != '}' && dataNew[index] != ' ' && dataNew[index] != '\t' &&
+					dataNew[index] != '\n' && dataNew[index] != '\r') {
+					++index;
+				}
+				return true;
+			};
+			skipWhiteSpace();
+			if (index >= dataNew.size() || dataNew[index] != '{') {
+				return false;
+			}
+			++index;
+			while (true) {
+				skipWhiteSpace();
+				if (index >= dataNew.size() || dataNew[index] == '}') {
+					return index < dataNew.size();
+				} else if (dataNew[index] != '"') {
+					return false;
+				}
+				uint64_t keyStart{ index + 1 };
+				if (!skipString()) {
+					return false;
+				}
+				std::string_view key{ dataNew.data() + keyStart, index - keyStart - 1 };
+				skipWhiteSpace();
+				if (index >= dataNew.size() || dataNew[index] != ':') {
+					return false;
+				}
+				++index;
+				skipWhiteSpace();
+				uint64_t valueStart{ index };
+				if (index >= dataNew.size() || !skipValue()) {
+					return false;
+				}
+				std::string_view value{ dataNew.data() + valueStart, index - valueStart };
+				if (key == "op") {
+					std::from_chars(value.data(), value.data() + value.size(), message.op);
+				} else if (key == "s") {
+					std::from_chars(value.data(), value.data() + value.size(), message.s);
+				} else if (key == "t") {
+					if (value.size() >= 2 && value.front() == '"') {
+						message.t = value.substr(1, value.size() - 2);
+					}
+				} else if (key == "d") {
+					payload = value;
+				}
+				skipWhiteSpace();
+				if (index < dataNew.size() && dataNew[index] == ',') {
+					++index;
+				}
+			}
+		}
+
 		bool WebSocketClient::onMessageReceived(std::string_view dataNew) {
 			try {
-				if (areWeConnected() && currentMessage.size() > 0 && dataNew.size() > 0) {
+				try {
+					if (doWeInflate && !inflater.inflate(dataNew, dataNew)) {
+						return true;
+					}
+				} catch (const DCAException& error) {
+					MessagePrinter::printError<PrintMessageType::WebSocket>(error.what());
+					// A corrupt zlib stream can't be recovered mid-connection, so reconnect with a fresh context.
+					inflater.reset();
+					onClosed();
+					return false;
+				}
+				if (areWeConnected() && dataNew.size() > 0) {
 					WebSocketMessage message{};
+					std::string_view payload{};
 					if (configManager->getTextFormat() == TextFormat::Etf) {
 						try {
-							dataNew = EtfParser::parseEtfToJson(dataNew);
-							parser.parseJson<true, true>(message, dataNew);
+							dataNew = EtfParser::parseEtfToJson(dataNew, message, payload);
 						} catch (const DCAException& error) {
 							MessagePrinter::printError<PrintMessageType::WebSocket>(error.what());
-							tcpConnection.getInputBuffer();
-							currentMessage.clear();
 							return false;
 						}
-					} else {
-						parser.parseJson<true, true>(message, dataNew);
+					} else if (!scanEnvelope(dataNew, message, payload)) {
+						MessagePrinter::printError<PrintMessageType::WebSocket>("WebSocketClient::onMessageReceived() Error: Failed to scan the message envelope.");
+						return false;
 					}
 
 					if (message.s != 0) {
@@ -530,18 +810,23 @@ namespace DiscordCoreAPI {
 					switch (static_cast<WebSocketOpCodes>(message.op)) {
 						case WebSocketOpCodes::Dispatch: {
 							if (message.t != "") {
-								switch (EventConverter{ message.t }) {
+								uint64_t eventIndex = EventConverter{ message.t };
+								if (!isEventWanted(eventIndex)) {
+									break;
+								}
+								switch (eventIndex) {
 									case 1: {
 										WebSocketMessageData<ReadyData> data{};
 										if (dataOpCode == WebSocketOpCode::Op_Text) {
 											data.d.excludedKeys.emplace("shard");
 										}
 										currentState.store(WebSocketState::Authenticated, std::memory_order_release);
-										parser.parseJson<true, true, true>(data, dataNew);
+										parser.parseJson<true, true, true>(data.d, payload);
 										sessionId = data.d.sessionId;
 										if (data.d.resumeGatewayUrl.find("wss://") != std::string::npos) {
 											resumeUrl = data.d.resumeGatewayUrl.substr(data.d.resumeGatewayUrl.find("wss://") + std::string{ "wss://" }.size());
 										}
+										CacheSnapshot::recordSession(shard[0], sessionId, resumeUrl);
 										discordCoreClient->currentUser = BotUser{ data.d.user,
 											discordCoreClient
 												->baseSocketAgentsMap[static_cast<uint64_t>(
@@ -553,61 +838,62 @@ namespace DiscordCoreAPI {
 									}
 									case 2: {
 										currentState.store(WebSocketState::Authenticated, std::memory_order_release);
+										CacheSnapshot::confirmSession(shard[0]);
 										currentReconnectTries = 0;
 										break;
 									}
 									case 3: {
 										if (discordCoreClient->eventManager.onApplicationCommandPermissionsUpdateEvent.functions.size() > 0) {
 											UniquePtr<OnApplicationCommandPermissionsUpdateData> dataPackage{ makeUnique<OnApplicationCommandPermissionsUpdateData>(parser,
-												dataNew) };
+												payload) };
 											discordCoreClient->eventManager.onApplicationCommandPermissionsUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 4: {
 										if (discordCoreClient->eventManager.onAutoModerationRuleCreationEvent.functions.size() > 0) {
-											UniquePtr<OnAutoModerationRuleCreationData> dataPackage{ makeUnique<OnAutoModerationRuleCreationData>(parser, dataNew) };
+											UniquePtr<OnAutoModerationRuleCreationData> dataPackage{ makeUnique<OnAutoModerationRuleCreationData>(parser, payload) };
 											discordCoreClient->eventManager.onAutoModerationRuleCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 5: {
 										if (discordCoreClient->eventManager.onAutoModerationRuleUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnAutoModerationRuleUpdateData> dataPackage{ makeUnique<OnAutoModerationRuleUpdateData>(parser, dataNew) };
+											UniquePtr<OnAutoModerationRuleUpdateData> dataPackage{ makeUnique<OnAutoModerationRuleUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onAutoModerationRuleUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 6: {
 										if (discordCoreClient->eventManager.onAutoModerationRuleDeletionEvent.functions.size() > 0) {
-											UniquePtr<OnAutoModerationRuleDeletionData> dataPackage{ makeUnique<OnAutoModerationRuleDeletionData>(parser, dataNew) };
+											UniquePtr<OnAutoModerationRuleDeletionData> dataPackage{ makeUnique<OnAutoModerationRuleDeletionData>(parser, payload) };
 											discordCoreClient->eventManager.onAutoModerationRuleDeletionEvent(*dataPackage);
 										}
 										break;
 									}
 									case 7: {
 										if (discordCoreClient->eventManager.onAutoModerationActionExecutionEvent.functions.size() > 0) {
-											UniquePtr<OnAutoModerationActionExecutionData> dataPackage{ makeUnique<OnAutoModerationActionExecutionData>(parser, dataNew) };
+											UniquePtr<OnAutoModerationActionExecutionData> dataPackage{ makeUnique<OnAutoModerationActionExecutionData>(parser, payload) };
 											discordCoreClient->eventManager.onAutoModerationActionExecutionEvent(*dataPackage);
 										}
 										break;
 									}
 									case 8: {
-										UniquePtr<OnChannelCreationData> dataPackage{ makeUnique<OnChannelCreationData>(parser, dataNew) };
+										UniquePtr<OnChannelCreationData> dataPackage{ makeUnique<OnChannelCreationData>(parser, payload) };
 										if (discordCoreClient->eventManager.onChannelCreationEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onChannelCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 9: {
-										UniquePtr<OnChannelUpdateData> dataPackage{ makeUnique<OnChannelUpdateData>(parser, dataNew) };
+										UniquePtr<OnChannelUpdateData> dataPackage{ makeUnique<OnChannelUpdateData>(parser, payload) };
 										if (discordCoreClient->eventManager.onChannelUpdateEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onChannelUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 10: {
-										UniquePtr<OnChannelDeletionData> dataPackage{ makeUnique<OnChannelDeletionData>(parser, dataNew) };
+										UniquePtr<OnChannelDeletionData> dataPackage{ makeUnique<OnChannelDeletionData>(parser, payload) };
 										if (discordCoreClient->eventManager.onChannelDeletionEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onChannelDeletionEvent(*dataPackage);
 										}
@@ -615,69 +901,69 @@ namespace DiscordCoreAPI {
 									}
 									case 11: {
 										if (discordCoreClient->eventManager.onChannelPinsUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnChannelPinsUpdateData> dataPackage{ makeUnique<OnChannelPinsUpdateData>(parser, dataNew) };
+											UniquePtr<OnChannelPinsUpdateData> dataPackage{ makeUnique<OnChannelPinsUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onChannelPinsUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 12: {
 										if (discordCoreClient->eventManager.onThreadCreationEvent.functions.size() > 0) {
-											UniquePtr<OnThreadCreationData> dataPackage{ makeUnique<OnThreadCreationData>(parser, dataNew) };
+											UniquePtr<OnThreadCreationData> dataPackage{ makeUnique<OnThreadCreationData>(parser, payload) };
 											discordCoreClient->eventManager.onThreadCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 13: {
 										if (discordCoreClient->eventManager.onThreadUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnThreadUpdateData> dataPackage{ makeUnique<OnThreadUpdateData>(parser, dataNew) };
+											UniquePtr<OnThreadUpdateData> dataPackage{ makeUnique<OnThreadUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onThreadUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 14: {
 										if (discordCoreClient->eventManager.onThreadDeletionEvent.functions.size() > 0) {
-											UniquePtr<OnThreadDeletionData> dataPackage{ makeUnique<OnThreadDeletionData>(parser, dataNew) };
+											UniquePtr<OnThreadDeletionData> dataPackage{ makeUnique<OnThreadDeletionData>(parser, payload) };
 											discordCoreClient->eventManager.onThreadDeletionEvent(*dataPackage);
 										}
 										break;
 									}
 									case 15: {
 										if (discordCoreClient->eventManager.onThreadListSyncEvent.functions.size() > 0) {
-											UniquePtr<OnThreadListSyncData> dataPackage{ makeUnique<OnThreadListSyncData>(parser, dataNew) };
+											UniquePtr<OnThreadListSyncData> dataPackage{ makeUnique<OnThreadListSyncData>(parser, payload) };
 											discordCoreClient->eventManager.onThreadListSyncEvent(*dataPackage);
 										}
 										break;
 									}
 									case 16: {
 										if (discordCoreClient->eventManager.onThreadMemberUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnThreadMemberUpdateData> dataPackage{ makeUnique<OnThreadMemberUpdateData>(parser, dataNew) };
+											UniquePtr<OnThreadMemberUpdateData> dataPackage{ makeUnique<OnThreadMemberUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onThreadMemberUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 17: {
 										if (discordCoreClient->eventManager.onThreadMembersUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnThreadMembersUpdateData> dataPackage{ makeUnique<OnThreadMembersUpdateData>(parser, dataNew) };
+											UniquePtr<OnThreadMembersUpdateData> dataPackage{ makeUnique<OnThreadMembersUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onThreadMembersUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 18: {
-										UniquePtr<OnGuildCreationData> dataPackage{ makeUnique<OnGuildCreationData>(parser, dataNew, discordCoreClient) };
+										UniquePtr<OnGuildCreationData> dataPackage{ makeUnique<OnGuildCreationData>(parser, payload, discordCoreClient) };
 										if (discordCoreClient->eventManager.onGuildCreationEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onGuildCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 19: {
-										UniquePtr<OnGuildUpdateData> dataPackage{ makeUnique<OnGuildUpdateData>(parser, dataNew, discordCoreClient) };
+										UniquePtr<OnGuildUpdateData> dataPackage{ makeUnique<OnGuildUpdateData>(parser, payload, discordCoreClient) };
 										if (discordCoreClient->eventManager.onGuildUpdateEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onGuildUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 20: {
-										UniquePtr<OnGuildDeletionData> dataPackage{ makeUnique<OnGuildDeletionData>(parser, dataNew) };
+										UniquePtr<OnGuildDeletionData> dataPackage{ makeUnique<OnGuildDeletionData>(parser, payload) };
 										if (discordCoreClient->eventManager.onGuildDeletionEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onGuildDeletionEvent(*dataPackage);
 										}
@@ -685,55 +971,55 @@ namespace DiscordCoreAPI {
 									}
 									case 21: {
 										if (discordCoreClient->eventManager.onGuildBanAddEvent.functions.size() > 0) {
-											UniquePtr<OnGuildBanAddData> dataPackage{ makeUnique<OnGuildBanAddData>(parser, dataNew) };
+											UniquePtr<OnGuildBanAddData> dataPackage{ makeUnique<OnGuildBanAddData>(parser, payload) };
 											discordCoreClient->eventManager.onGuildBanAddEvent(*dataPackage);
 										}
 										break;
 									}
 									case 22: {
 										if (discordCoreClient->eventManager.onGuildBanRemoveEvent.functions.size() > 0) {
-											UniquePtr<OnGuildBanRemoveData> dataPackage{ makeUnique<OnGuildBanRemoveData>(parser, dataNew) };
+											UniquePtr<OnGuildBanRemoveData> dataPackage{ makeUnique<OnGuildBanRemoveData>(parser, payload) };
 											discordCoreClient->eventManager.onGuildBanRemoveEvent(*dataPackage);
 										}
 										break;
 									}
 									case 23: {
 										if (discordCoreClient->eventManager.onGuildEmojisUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnGuildEmojisUpdateData> dataPackage{ makeUnique<OnGuildEmojisUpdateData>(parser, dataNew) };
+											UniquePtr<OnGuildEmojisUpdateData> dataPackage{ makeUnique<OnGuildEmojisUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onGuildEmojisUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 24: {
 										if (discordCoreClient->eventManager.onGuildStickersUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnGuildStickersUpdateData> dataPackage{ makeUnique<OnGuildStickersUpdateData>(parser, dataNew) };
+											UniquePtr<OnGuildStickersUpdateData> dataPackage{ makeUnique<OnGuildStickersUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onGuildStickersUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 25: {
 										if (discordCoreClient->eventManager.onGuildIntegrationsUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnGuildIntegrationsUpdateData> dataPackage{ makeUnique<OnGuildIntegrationsUpdateData>(parser, dataNew) };
+											UniquePtr<OnGuildIntegrationsUpdateData> dataPackage{ makeUnique<OnGuildIntegrationsUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onGuildIntegrationsUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 26: {
-										UniquePtr<OnGuildMemberAddData> dataPackage{ makeUnique<OnGuildMemberAddData>(parser, dataNew) };
+										UniquePtr<OnGuildMemberAddData> dataPackage{ makeUnique<OnGuildMemberAddData>(parser, payload) };
 										if (discordCoreClient->eventManager.onGuildMemberAddEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onGuildMemberAddEvent(*dataPackage);
 										}
 										break;
 									}
 									case 27: {
-										UniquePtr<OnGuildMemberRemoveData> dataPackage{ makeUnique<OnGuildMemberRemoveData>(parser, dataNew) };
+										UniquePtr<OnGuildMemberRemoveData> dataPackage{ makeUnique<OnGuildMemberRemoveData>(parser, payload) };
 										if (discordCoreClient->eventManager.onGuildMemberRemoveEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onGuildMemberRemoveEvent(*dataPackage);
 										}
 										break;
 									}
 									case 28: {
-										UniquePtr<OnGuildMemberUpdateData> dataPackage{ makeUnique<OnGuildMemberUpdateData>(parser, dataNew) };
+										UniquePtr<OnGuildMemberUpdateData> dataPackage{ makeUnique<OnGuildMemberUpdateData>(parser, payload) };
 										if (discordCoreClient->eventManager.onGuildMemberUpdateEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onGuildMemberUpdateEvent(*dataPackage);
 										}
@@ -741,27 +1027,27 @@ namespace DiscordCoreAPI {
 									}
 									case 29: {
 										if (discordCoreClient->eventManager.onGuildMembersChunkEvent.functions.size() > 0) {
-											UniquePtr<OnGuildMembersChunkData> dataPackage{ makeUnique<OnGuildMembersChunkData>(parser, dataNew) };
+											UniquePtr<OnGuildMembersChunkData> dataPackage{ makeUnique<OnGuildMembersChunkData>(parser, payload) };
 											discordCoreClient->eventManager.onGuildMembersChunkEvent(*dataPackage);
 										}
 										break;
 									}
 									case 30: {
-										UniquePtr<OnRoleCreationData> dataPackage{ makeUnique<OnRoleCreationData>(parser, dataNew) };
+										UniquePtr<OnRoleCreationData> dataPackage{ makeUnique<OnRoleCreationData>(parser, payload) };
 										if (discordCoreClient->eventManager.onRoleCreationEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onRoleCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 31: {
-										UniquePtr<OnRoleUpdateData> dataPackage{ makeUnique<OnRoleUpdateData>(parser, dataNew) };
+										UniquePtr<OnRoleUpdateData> dataPackage{ makeUnique<OnRoleUpdateData>(parser, payload) };
 										if (discordCoreClient->eventManager.onRoleUpdateEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onRoleUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 32: {
-										UniquePtr<OnRoleDeletionData> dataPackage{ makeUnique<OnRoleDeletionData>(parser, dataNew) };
+										UniquePtr<OnRoleDeletionData> dataPackage{ makeUnique<OnRoleDeletionData>(parser, payload) };
 										if (discordCoreClient->eventManager.onRoleDeletionEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onRoleDeletionEvent(*dataPackage);
 										}
@@ -769,62 +1055,62 @@ namespace DiscordCoreAPI {
 									}
 									case 33: {
 										if (discordCoreClient->eventManager.onGuildScheduledEventCreationEvent.functions.size() > 0) {
-											UniquePtr<OnGuildScheduledEventCreationData> dataPackage{ makeUnique<OnGuildScheduledEventCreationData>(parser, dataNew) };
+											UniquePtr<OnGuildScheduledEventCreationData> dataPackage{ makeUnique<OnGuildScheduledEventCreationData>(parser, payload) };
 											discordCoreClient->eventManager.onGuildScheduledEventCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 34: {
 										if (discordCoreClient->eventManager.onGuildScheduledEventUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnGuildScheduledEventUpdateData> dataPackage{ makeUnique<OnGuildScheduledEventUpdateData>(parser, dataNew) };
+											UniquePtr<OnGuildScheduledEventUpdateData> dataPackage{ makeUnique<OnGuildScheduledEventUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onGuildScheduledEventUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 35: {
 										if (discordCoreClient->eventManager.onGuildScheduledEventDeletionEvent.functions.size() > 0) {
-											UniquePtr<OnGuildScheduledEventDeletionData> dataPackage{ makeUnique<OnGuildScheduledEventDeletionData>(parser, dataNew) };
+											UniquePtr<OnGuildScheduledEventDeletionData> dataPackage{ makeUnique<OnGuildScheduledEventDeletionData>(parser, payload) };
 											discordCoreClient->eventManager.onGuildScheduledEventDeletionEvent(*dataPackage);
 										}
 										break;
 									}
 									case 36: {
 										if (discordCoreClient->eventManager.onGuildScheduledEventUserAddEvent.functions.size() > 0) {
-											UniquePtr<OnGuildScheduledEventUserAddData> dataPackage{ makeUnique<OnGuildScheduledEventUserAddData>(parser, dataNew) };
+											UniquePtr<OnGuildScheduledEventUserAddData> dataPackage{ makeUnique<OnGuildScheduledEventUserAddData>(parser, payload) };
 											discordCoreClient->eventManager.onGuildScheduledEventUserAddEvent(*dataPackage);
 										}
 										break;
 									}
 									case 37: {
 										if (discordCoreClient->eventManager.onGuildScheduledEventUserRemoveEvent.functions.size() > 0) {
-											UniquePtr<OnGuildScheduledEventUserRemoveData> dataPackage{ makeUnique<OnGuildScheduledEventUserRemoveData>(parser, dataNew) };
+											UniquePtr<OnGuildScheduledEventUserRemoveData> dataPackage{ makeUnique<OnGuildScheduledEventUserRemoveData>(parser, payload) };
 											discordCoreClient->eventManager.onGuildScheduledEventUserRemoveEvent(*dataPackage);
 										}
 										break;
 									}
 									case 38: {
 										if (discordCoreClient->eventManager.onIntegrationCreationEvent.functions.size() > 0) {
-											UniquePtr<OnIntegrationCreationData> dataPackage{ makeUnique<OnIntegrationCreationData>(parser, dataNew) };
+											UniquePtr<OnIntegrationCreationData> dataPackage{ makeUnique<OnIntegrationCreationData>(parser, payload) };
 											discordCoreClient->eventManager.onIntegrationCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 39: {
 										if (discordCoreClient->eventManager.onIntegrationUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnIntegrationUpdateData> dataPackage{ makeUnique<OnIntegrationUpdateData>(parser, dataNew) };
+											UniquePtr<OnIntegrationUpdateData> dataPackage{ makeUnique<OnIntegrationUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onIntegrationUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 40: {
 										if (discordCoreClient->eventManager.onIntegrationDeletionEvent.functions.size() > 0) {
-											UniquePtr<OnIntegrationDeletionData> dataPackage{ makeUnique<OnIntegrationDeletionData>(parser, dataNew) };
+											UniquePtr<OnIntegrationDeletionData> dataPackage{ makeUnique<OnIntegrationDeletionData>(parser, payload) };
 											discordCoreClient->eventManager.onIntegrationDeletionEvent(*dataPackage);
 										}
 										break;
 									}
 									case 41: {
-										UniquePtr<OnInteractionCreationData> dataPackage{ makeUnique<OnInteractionCreationData>(parser, dataNew, discordCoreClient) };
+										UniquePtr<OnInteractionCreationData> dataPackage{ makeUnique<OnInteractionCreationData>(parser, payload, discordCoreClient) };
 										if (discordCoreClient->eventManager.onInteractionCreationEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onInteractionCreationEvent(*dataPackage);
 										}
@@ -832,27 +1118,27 @@ namespace DiscordCoreAPI {
 									}
 									case 42: {
 										if (discordCoreClient->eventManager.onInviteCreationEvent.functions.size() > 0) {
-											UniquePtr<OnInviteCreationData> dataPackage{ makeUnique<OnInviteCreationData>(parser, dataNew) };
+											UniquePtr<OnInviteCreationData> dataPackage{ makeUnique<OnInviteCreationData>(parser, payload) };
 											discordCoreClient->eventManager.onInviteCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 43: {
 										if (discordCoreClient->eventManager.onInviteDeletionEvent.functions.size() > 0) {
-											UniquePtr<OnInviteDeletionData> dataPackage{ makeUnique<OnInviteDeletionData>(parser, dataNew) };
+											UniquePtr<OnInviteDeletionData> dataPackage{ makeUnique<OnInviteDeletionData>(parser, payload) };
 											discordCoreClient->eventManager.onInviteDeletionEvent(*dataPackage);
 										}
 										break;
 									}
 									case 44: {
-										UniquePtr<OnMessageCreationData> dataPackage{ makeUnique<OnMessageCreationData>(parser, dataNew) };
+										UniquePtr<OnMessageCreationData> dataPackage{ makeUnique<OnMessageCreationData>(parser, payload) };
 										if (discordCoreClient->eventManager.onMessageCreationEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onMessageCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 45: {
-										UniquePtr<OnMessageUpdateData> dataPackage{ makeUnique<OnMessageUpdateData>(parser, dataNew) };
+										UniquePtr<OnMessageUpdateData> dataPackage{ makeUnique<OnMessageUpdateData>(parser, payload) };
 										if (discordCoreClient->eventManager.onMessageUpdateEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onMessageUpdateEvent(*dataPackage);
 										}
@@ -860,48 +1146,48 @@ namespace DiscordCoreAPI {
 									}
 									case 46: {
 										if (discordCoreClient->eventManager.onMessageDeletionEvent.functions.size() > 0) {
-											UniquePtr<OnMessageDeletionData> dataPackage{ makeUnique<OnMessageDeletionData>(parser, dataNew) };
+											UniquePtr<OnMessageDeletionData> dataPackage{ makeUnique<OnMessageDeletionData>(parser, payload) };
 											discordCoreClient->eventManager.onMessageDeletionEvent(*dataPackage);
 										}
 										break;
 									}
 									case 47: {
 										if (discordCoreClient->eventManager.onMessageDeleteBulkEvent.functions.size() > 0) {
-											UniquePtr<OnMessageDeleteBulkData> dataPackage{ makeUnique<OnMessageDeleteBulkData>(parser, dataNew) };
+											UniquePtr<OnMessageDeleteBulkData> dataPackage{ makeUnique<OnMessageDeleteBulkData>(parser, payload) };
 											discordCoreClient->eventManager.onMessageDeleteBulkEvent(*dataPackage);
 										}
 										break;
 									}
 									case 48: {
 										if (discordCoreClient->eventManager.onReactionAddEvent.functions.size() > 0) {
-											UniquePtr<OnReactionAddData> dataPackage{ makeUnique<OnReactionAddData>(parser, dataNew) };
+											UniquePtr<OnReactionAddData> dataPackage{ makeUnique<OnReactionAddData>(parser, payload) };
 											discordCoreClient->eventManager.onReactionAddEvent(*dataPackage);
 										}
 										break;
 									}
 									case 49: {
 										if (discordCoreClient->eventManager.onReactionRemoveEvent.functions.size() > 0) {
-											UniquePtr<OnReactionRemoveData> dataPackage{ makeUnique<OnReactionRemoveData>(parser, dataNew) };
+											UniquePtr<OnReactionRemoveData> dataPackage{ makeUnique<OnReactionRemoveData>(parser, payload) };
 											discordCoreClient->eventManager.onReactionRemoveEvent(*dataPackage);
 										}
 										break;
 									}
 									case 50: {
 										if (discordCoreClient->eventManager.onReactionRemoveAllEvent.functions.size() > 0) {
-											UniquePtr<OnReactionRemoveAllData> dataPackage{ makeUnique<OnReactionRemoveAllData>(parser, dataNew) };
+											UniquePtr<OnReactionRemoveAllData> dataPackage{ makeUnique<OnReactionRemoveAllData>(parser, payload) };
 											discordCoreClient->eventManager.onReactionRemoveAllEvent(*dataPackage);
 										}
 										break;
 									}
 									case 51: {
 										if (discordCoreClient->eventManager.onReactionRemoveEmojiEvent.functions.size() > 0) {
-											UniquePtr<OnReactionRemoveEmojiData> dataPackage{ makeUnique<OnReactionRemoveEmojiData>(parser, dataNew) };
+											UniquePtr<OnReactionRemoveEmojiData> dataPackage{ makeUnique<OnReactionRemoveEmojiData>(parser, payload) };
 											discordCoreClient->eventManager.onReactionRemoveEmojiEvent(*dataPackage);
 										}
 										break;
 									}
 									case 52: {
-										UniquePtr<OnPresenceUpdateData> dataPackage{ makeUnique<OnPresenceUpdateData>(parser, dataNew) };
+										UniquePtr<OnPresenceUpdateData> dataPackage{ makeUnique<OnPresenceUpdateData>(parser, payload) };
 										if (discordCoreClient->eventManager.onPresenceUpdateEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onPresenceUpdateEvent(*dataPackage);
 										}
@@ -909,48 +1195,48 @@ namespace DiscordCoreAPI {
 									}
 									case 53: {
 										if (discordCoreClient->eventManager.onStageInstanceCreationEvent.functions.size() > 0) {
-											UniquePtr<OnStageInstanceCreationData> dataPackage{ makeUnique<OnStageInstanceCreationData>(parser, dataNew) };
+											UniquePtr<OnStageInstanceCreationData> dataPackage{ makeUnique<OnStageInstanceCreationData>(parser, payload) };
 											discordCoreClient->eventManager.onStageInstanceCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 54: {
 										if (discordCoreClient->eventManager.onStageInstanceUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnStageInstanceUpdateData> dataPackage{ makeUnique<OnStageInstanceUpdateData>(parser, dataNew) };
+											UniquePtr<OnStageInstanceUpdateData> dataPackage{ makeUnique<OnStageInstanceUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onStageInstanceUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 55: {
 										if (discordCoreClient->eventManager.onStageInstanceDeletionEvent.functions.size() > 0) {
-											UniquePtr<OnStageInstanceDeletionData> dataPackage{ makeUnique<OnStageInstanceDeletionData>(parser, dataNew) };
+											UniquePtr<OnStageInstanceDeletionData> dataPackage{ makeUnique<OnStageInstanceDeletionData>(parser, payload) };
 											discordCoreClient->eventManager.onStageInstanceDeletionEvent(*dataPackage);
 										}
 										break;
 									}
 									case 56: {
 										if (discordCoreClient->eventManager.onTypingStartEvent.functions.size() > 0) {
-											UniquePtr<OnTypingStartData> dataPackage{ makeUnique<OnTypingStartData>(parser, dataNew) };
+											UniquePtr<OnTypingStartData> dataPackage{ makeUnique<OnTypingStartData>(parser, payload) };
 											discordCoreClient->eventManager.onTypingStartEvent(*dataPackage);
 										}
 										break;
 									}
 									case 57: {
 										if (discordCoreClient->eventManager.onUserUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnUserUpdateData> dataPackage{ makeUnique<OnUserUpdateData>(parser, dataNew) };
+											UniquePtr<OnUserUpdateData> dataPackage{ makeUnique<OnUserUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onUserUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 58: {
-										UniquePtr<OnVoiceStateUpdateData> dataPackage{ makeUnique<OnVoiceStateUpdateData>(parser, dataNew, this) };
+										UniquePtr<OnVoiceStateUpdateData> dataPackage{ makeUnique<OnVoiceStateUpdateData>(parser, payload, this) };
 										if (discordCoreClient->eventManager.onVoiceStateUpdateEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onVoiceStateUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 59: {
-										UniquePtr<OnVoiceServerUpdateData> dataPackage{ makeUnique<OnVoiceServerUpdateData>(parser, dataNew, this) };
+										UniquePtr<OnVoiceServerUpdateData> dataPackage{ makeUnique<OnVoiceServerUpdateData>(parser, payload, this) };
 										if (discordCoreClient->eventManager.onVoiceServerUpdateEvent.functions.size() > 0) {
 											discordCoreClient->eventManager.onVoiceServerUpdateEvent(*dataPackage);
 										}
@@ -958,12 +1244,15 @@ namespace DiscordCoreAPI {
 									}
 									case 60: {
 										if (discordCoreClient->eventManager.onWebhookUpdateEvent.functions.size() > 0) {
-											UniquePtr<OnWebhookUpdateData> dataPackage{ makeUnique<OnWebhookUpdateData>(parser, dataNew) };
+											UniquePtr<OnWebhookUpdateData> dataPackage{ makeUnique<OnWebhookUpdateData>(parser, payload) };
 											discordCoreClient->eventManager.onWebhookUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 								}
+								if (message.s != 0) {
+									CacheSnapshot::recordSequence(shard[0], message.s);
+								}
 							}
 							break;
 						}
@@ -981,8 +1270,6 @@ namespace DiscordCoreAPI {
 							return true;
 						}
 						case WebSocketOpCodes::Invalid_Session: {
-							WebSocketMessageData<bool> data{};
-							parser.parseJson<true, true>(data, dataNew);
 							MessagePrinter::printError<PrintMessageType::WebSocket>(
 								"Shard [" + std::to_string(shard[0]) + "," + std::to_string(shard[1]) + "]" + " Reconnecting (Type 9)!");
 							std::mt19937_64 randomEngine{ static_cast<uint64_t>(HRClock::now().time_since_epoch().count()) };
@@ -991,17 +1278,16 @@ namespace DiscordCoreAPI {
 							if (numOfMsToWait <= 5000 && numOfMsToWait > 0) {
 								std::this_thread::sleep_for(Milliseconds{ numOfMsToWait });
 							}
-							if (data.d == true) {
-								areWeResuming = true;
-							} else {
-								areWeResuming = false;
+							areWeResuming = payload == "true";
+							if (!areWeResuming) {
+								CacheSnapshot::dropSession(shard[0]);
 							}
 							onClosed();
 							return true;
 						}
 						case WebSocketOpCodes::Hello: {
 							WebSocketMessageData<HelloData> data{};
-							parser.parseJson<true, true>(data, dataNew);
+							parser.parseJson<true, true>(data.d, payload);
 							if (data.d.heartbeatInterval != 0) {
 								areWeHeartBeating  = true;
 								heartBeatStopWatch = StopWatch<Milliseconds>{ Milliseconds{ data.d.heartbeatInterval } };
@@ -1071,9 +1357,9 @@ namespace DiscordCoreAPI {
 			return false;
 		}
 
-		void WebSocketCore::disconnect() {
+		void WebSocketCore::disconnect(uint16_t closeCode) {
 			if (areWeConnected()) {
-				std::string dataNew{ "\x03\xE8" };
+				std::string dataNew{ static_cast<char>(closeCode >> 8), static_cast<char>(closeCode & 0xff) };
 				createHeader(dataNew, WebSocketOpCode::Op_Close);
 				tcpConnection.writeData(dataNew, true);
 				tcpConnection.disconnect();
@@ -1096,8 +1382,9 @@ namespace DiscordCoreAPI {
 			}
 		}
 
+		/// When snapshots are on, the session was saved to be resumed by the next run - which closing with 1000 would invalidate.
 		WebSocketClient::~WebSocketClient() {
-			disconnect();
+			WebSocketCore::disconnect(CacheSnapshot::doWeSnapshot() ? resumableCloseCode : 1000);
 		}
 
 		BaseSocketAgent::BaseSocketAgent(DiscordCoreClient* discordCoreClientNew, std::atomic_bool* doWeQuitNew, uint64_t currentBaseSocketAgentNew) {
@@ -1145,6 +1432,9 @@ namespace DiscordCoreAPI {
 					std::to_string(packageNew.currentShard + 1) + " of " + std::to_string(discordCoreClient->configManager.getTotalShardCount()) +
 					std::string{ " Shards total across all processes)" });
 				std::string relativePath{ "/?v=10&encoding=" + std::string{ discordCoreClient->configManager.getTextFormat() == TextFormat::Etf ? "etf" : "json" } };
+				if (getClient(packageNew.currentShard).doWeInflate) {
+					relativePath += "&compress=zlib-stream";
+				}
 				bool didWeConnect{ getClient(packageNew.currentShard).connect(connectionUrl, relativePath, discordCoreClient->configManager.getConnectionPort()) };
 				if (!didWeConnect) {
 					getClient(packageNew.currentShard).areWeResuming = false;
@@ -1161,35 +1451,46 @@ namespace DiscordCoreAPI {
 		}
 
 		WebSocketClient& BaseSocketAgent::getClient(uint32_t index) {
-			return shardMap[index];
+			std::unique_lock lock{ shardMutex };
+			return *shardMap.at(static_cast<uint64_t>(index));
+		}
+
+		void BaseSocketAgent::addClient(uint32_t index, UniquePtr<WebSocketClient>&& client) {
+			std::unique_lock lock{ shardMutex };
+			shardMap[static_cast<uint64_t>(index)] = std::move(client);
+			lock.unlock();
+			reactor.wakeUp();
 		}
 
 		void BaseSocketAgent::run(StopToken token) {
-			UnorderedMap<uint64_t, WebSocketTCPConnection*> processIOMapNew{};
+			Jsonifier::Vector<Pair<uint64_t, WebSocketClient*>> clients{};
 			while (!token.stopRequested() && !doWeQuit->load(std::memory_order_acquire)) {
 				try {
+					Milliseconds waitTime{ maxReactorWaitTime };
+					bool areWeConnected{};
+					std::unique_lock lock{ shardMutex };
+					clients.clear();
 					for (auto& [key, value]: shardMap) {
-						if (value.areWeConnected()) {
-							processIOMapNew.emplace(key, &value.tcpConnection);
-						}
-					}
-					auto result = TCPConnection<WebSocketTCPConnection>::processIO(processIOMapNew);
-					processIOMapNew.clear();
-					for (auto& [key, value]: result) {
-						MessagePrinter::printError<PrintMessageType::WebSocket>("Connection lost for WebSocket [" + std::to_string(shardMap[key].shard[0]) + "," +
-							std::to_string(discordCoreClient->configManager.getTotalShardCount()) + "]... reconnecting.");
-						shardMap[key].onClosed();
+						clients.emplace_back(key, value.get());
 					}
-					bool areWeConnected{};
-					for (auto& [key, dValueNew]: shardMap) {
+					lock.unlock();
+					for (auto& [key, value]: clients) {
+						WebSocketClient& dValueNew{ *value };
 						if (dValueNew.areWeConnected()) {
+							reactor.registerConnection(key, &dValueNew.tcpConnection);
 							if (dValueNew.checkForAndSendHeartBeat()) {
 								OnGatewayPingData dataNew{};
 								dataNew.timeUntilNextPing = dValueNew.heartBeatStopWatch.getTotalWaitTime().count();
 								discordCoreClient->eventManager.onGatewayPingEvent(dataNew);
 							}
+							if (dValueNew.areWeHeartBeating && dValueNew.haveWeReceivedHeartbeatAck &&
+								dValueNew.currentState.load(std::memory_order_acquire) == WebSocketState::Authenticated) {
+								auto timeRemaining = dValueNew.heartBeatStopWatch.getTotalWaitTime() - dValueNew.heartBeatStopWatch.totalTimePassed();
+								waitTime		   = std::min(waitTime, std::max(std::chrono::duration_cast<Milliseconds>(timeRemaining), 0ms));
+							}
 							areWeConnected = true;
 						} else {
+							reactor.removeConnection(key);
 							ConnectionPackage connectionPackage{};
 							++dValueNew.currentReconnectTries;
 							connectionPackage.currentReconnectTries = dValueNew.currentReconnectTries;
@@ -1200,6 +1501,12 @@ namespace DiscordCoreAPI {
 					}
 					if (!areWeConnected) {
 						std::this_thread::sleep_for(1ms);
+						continue;
+					}
+					for (auto& key: reactor.processIO(waitTime)) {
+						MessagePrinter::printError<PrintMessageType::WebSocket>("Connection lost for WebSocket [" + std::to_string(getClient(static_cast<uint32_t>(key)).shard[0]) + "," +
+							std::to_string(discordCoreClient->configManager.getTotalShardCount()) + "]... reconnecting.");
+						getClient(static_cast<uint32_t>(key)).onClosed();
 					}
 				} catch (const DCAException& error) {
 					MessagePrinter::printError<PrintMessageType::WebSocket>(error.what());
@@ -1210,6 +1517,7 @@ namespace DiscordCoreAPI {
 		BaseSocketAgent::~BaseSocketAgent() {
 			if (taskThread) {
 				taskThread->requestStop();
+				reactor.wakeUp();
 				if (taskThread->joinable()) {
 					taskThread->join();
 				}
@@ -186,6 +186,9 @@ namespace DiscordCoreAPI {
 
 	namespace DiscordCoreInternal {
 
+		// Small enough that the first audio arrives quickly, and that several ranges fit within the read-ahead.
+		constexpr uint64_t youTubeRangeSize{ 1024ull * 256ull };
+
 		YouTubeRequestBuilder::YouTubeRequestBuilder(ConfigManager* configManagerNew) : HttpsClientCore{ configManagerNew->getBotToken() } {
 		}
 
@@ -322,7 +325,8 @@ namespace DiscordCoreAPI {
 		}
 
 		YouTubeAPI::YouTubeAPI(ConfigManager* configManagerNew, const Snowflake guildIdNew) : YouTubeRequestBuilder{ configManagerNew } {
-			guildId = guildIdNew;
+			streamingOptions = configManagerNew->getStreamingOptions();
+			guildId			 = guildIdNew;
 		}
 
 		void YouTubeAPI::weFailedToDownloadOrDecode(const Song& songNew, NewThreadAwaiter<void, false> threadHandle, uint64_t currentRetries) {
@@ -344,10 +348,7 @@ namespace DiscordCoreAPI {
 					threadHandle = NewThreadAwaitable<void, false>();
 				}
 				coroHandle = co_await threadHandle;
-				uint64_t intervalCount{ songNew.contentLength / (1024ull * 1024ull) + 1ull };
-				uint64_t remainder{ songNew.contentLength % (1024ull * 1024ull) };
-				uint64_t currentStart{};
-				uint64_t currentEnd{ intervalCount > 1 ? (1024ull * 1024ull) : remainder };
+				uint64_t intervalCount{ (songNew.contentLength + youTubeRangeSize - 1) / youTubeRangeSize };
 				Jsonifier::Vector<HttpsWorkloadData> workloadVector{};
 				for (uint64_t x = 0; x < intervalCount; ++x) {
 					HttpsWorkloadData workloadData{ HttpsWorkloadType::YouTubeGetSearchResults };
@@ -365,31 +366,30 @@ namespace DiscordCoreAPI {
 					workloadData.headersToInsert["Connection"] = "Keep-Alive";
 					workloadData.headersToInsert["Host"]	   = songNew.finalDownloadUrls[0].urlPath;
 					workloadData.headersToInsert["Origin"]	   = "https://music.youtube.com";
-					workloadData.relativePath				   = songNew.finalDownloadUrls[1].urlPath + "&range=" + std::to_string(currentStart) + "-" + std::to_string(currentEnd);
+					// The range is inclusive of its end, so the ranges mustn't overlap by a byte - the demuxer reads them as one stream.
+					uint64_t currentStart{ x * youTubeRangeSize };
+					uint64_t currentEnd{ std::min(currentStart + youTubeRangeSize, songNew.contentLength) - 1 };
+					workloadData.relativePath = songNew.finalDownloadUrls[1].urlPath + "&range=" + std::to_string(currentStart) + "-" + std::to_string(currentEnd);
 					workloadVector.emplace_back(std::move(workloadData));
-					currentStart = currentEnd;
-					currentEnd += x == intervalCount - 2 ? remainder : (1024ull * 1024ull);
 				}
-				std::basic_string<uint8_t> buffer{};
+				uint64_t maxQueuedFrames{ std::max<uint64_t>(streamingOptions.readAheadInSeconds, 1) * SongAPI::framesPerSecond };
+				HttpsRangePrefetcher prefetcher{ *this, std::move(workloadVector), streamingOptions };
 				MatroskaDemuxer demuxer{};
-				uint64_t index{};
-				while (index < intervalCount || !demuxer.areWeDone()) {
-					if (index < intervalCount) {
-						HttpsResponseData result{ submitWorkloadAndGetResult(std::move(workloadVector[index])) };
+				bool areWeDownloading{ true };
+				while (areWeDownloading) {
+					HttpsResponseData result{};
+					areWeDownloading = prefetcher.collectResponse(result);
+					if (areWeDownloading) {
 						if (result.responseCode != 200) {
 							areWeWorkingBool.store(false, std::memory_order_release);
 							weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
 							co_return;
 						}
-						if (result.responseData.size() > 0) {
-							++index;
-							auto oldSize = buffer.size();
-							buffer.resize(buffer.size() + result.responseData.size());
-							std::memcpy(buffer.data() + oldSize, result.responseData.data(), result.responseData.size());
-							demuxer.writeData({ buffer.data(), buffer.size() });
-							demuxer.proceedDemuxing();
-						}
+						demuxer.writeData({ reinterpret_cast<const uint8_t*>(result.responseData.data()), result.responseData.size() });
+					} else {
+						demuxer.endOfStream();
 					}
+					demuxer.proceedDemuxing();
 					bool didWeReceive{ true };
 					do {
 						AudioFrameData frameData{};
@@ -403,7 +403,13 @@ namespace DiscordCoreAPI {
 							DiscordCoreClient::getSongAPI(guildId).audioDataBuffer.send(std::move(frameData));
 						}
 					} while (didWeReceive);
-					std::this_thread::sleep_for(1ms);
+					DiscordCoreClient::getSongAPI(guildId).waitForQueueSpace(maxQueuedFrames, [&] {
+						return coroHandle.promise().areWeStopped();
+					});
+					if (coroHandle.promise().areWeStopped()) {
+						areWeWorkingBool.store(false, std::memory_order_release);
+						co_return;
+					}
 				}
 				areWeWorkingBool.store(false, std::memory_order_release);
 				DiscordCoreClient::getVoiceConnection(guildId).skip(false);
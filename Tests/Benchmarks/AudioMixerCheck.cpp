@@ -0,0 +1,101 @@
+// AudioMixerCheck.cpp - Checks AudioMixer's vectorized conversions against a scalar reference, and measures both.
+// Oct 18, 2026
+// https://discordcoreapi.com
+
+#include <discordcoreapi/Utilities/ISADetection.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+	using DiscordCoreAPI::DiscordCoreInternal::AudioMixer;
+
+	constexpr int64_t sampleCount{ 1920 };///< One 20 ms stereo frame at 48 kHz.
+	constexpr uint64_t frameCount{ 20000 };
+
+	/// Applies a gain ramp and saturates to int16_t, as VoiceConnection does a register at a time.
+	void mixVectorized(int32_t* upSampledVector, int16_t* downSampledVector, float currentGain, float increment) {
+		for (int64_t x = 0; x < sampleCount / AudioMixer::byteBlocksPerRegister; ++x) {
+			AudioMixer::collectSingleRegister(upSampledVector + (x * AudioMixer::byteBlocksPerRegister), downSampledVector + (x * AudioMixer::byteBlocksPerRegister),
+				currentGain, increment);
+			currentGain += increment * static_cast<float>(AudioMixer::byteBlocksPerRegister);
+		}
+	}
+
+	void mixScalar(const int32_t* upSampledVector, int16_t* downSampledVector, float currentGain, float increment) {
+		for (int64_t x = 0; x < sampleCount; ++x) {
+			float sample{ std::nearbyint(static_cast<float>(upSampledVector[x]) * (currentGain + increment * static_cast<float>(x))) };
+			sample				 = std::min(std::max(sample, static_cast<float>(std::numeric_limits<int16_t>::min())), static_cast<float>(std::numeric_limits<int16_t>::max()));
+			downSampledVector[x] = static_cast<int16_t>(sample);
+		}
+	}
+
+}
+
+int32_t main() {
+	bool didWePass{ true };
+	std::mt19937_64 randomEngine{ 1 };
+	std::vector<int16_t> decodedOne(sampleCount);
+	std::vector<int16_t> decodedTwo(sampleCount);
+	for (int64_t x = 0; x < sampleCount; ++x) {
+		decodedOne[static_cast<uint64_t>(x)] = static_cast<int16_t>(randomEngine());
+		decodedTwo[static_cast<uint64_t>(x)] = static_cast<int16_t>(randomEngine());
+	}
+	// Push a few samples to the extremes, so that saturation is exercised.
+	decodedOne[0] = decodedTwo[0] = std::numeric_limits<int16_t>::max();
+	decodedOne[1] = decodedTwo[1] = std::numeric_limits<int16_t>::min();
+
+	// combineSamples must sum exactly.
+	std::vector<int32_t> upSampled(sampleCount);
+	for (int64_t x = 0; x < sampleCount; x += AudioMixer::byteBlocksPerRegister) {
+		AudioMixer::combineSamples(upSampled.data() + x, decodedOne.data() + x);
+		AudioMixer::combineSamples(upSampled.data() + x, decodedTwo.data() + x);
+	}
+	for (uint64_t x = 0; x < sampleCount; ++x) {
+		if (upSampled[x] != static_cast<int32_t>(decodedOne[x]) + static_cast<int32_t>(decodedTwo[x])) {
+			std::cout << "FAIL: combineSamples summed sample " << x << " to " << upSampled[x] << "." << std::endl;
+			didWePass = false;
+			break;
+		}
+	}
+
+	// collectSingleRegister must match the reference to within a unit of rounding, including where it saturates.
+	std::vector<int16_t> vectorizedOut(sampleCount);
+	std::vector<int16_t> scalarOut(sampleCount);
+	for (float currentGain: { 0.0f, 0.5f, 1.0f, 1.7f }) {
+		float increment{ 0.25f / static_cast<float>(sampleCount) };
+		mixVectorized(upSampled.data(), vectorizedOut.data(), currentGain, increment);
+		mixScalar(upSampled.data(), scalarOut.data(), currentGain, increment);
+		for (uint64_t x = 0; x < sampleCount; ++x) {
+			if (std::abs(static_cast<int32_t>(vectorizedOut[x]) - static_cast<int32_t>(scalarOut[x])) > 1) {
+				std::cout << "FAIL: collectSingleRegister gave " << vectorizedOut[x] << " rather than " << scalarOut[x] << " for sample " << x << ", at a gain of "
+						  << currentGain << "." << std::endl;
+				didWePass = false;
+				break;
+			}
+		}
+	}
+
+	int64_t checksum{};
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint64_t x = 0; x < frameCount; ++x) {
+		mixVectorized(upSampled.data(), vectorizedOut.data(), 0.9f, 0.0f);
+		checksum += vectorizedOut[x % sampleCount];
+	}
+	std::chrono::duration<double> vectorizedTime{ std::chrono::steady_clock::now() - startTime };
+	startTime = std::chrono::steady_clock::now();
+	for (uint64_t x = 0; x < frameCount; ++x) {
+		mixScalar(upSampled.data(), scalarOut.data(), 0.9f, 0.0f);
+		checksum += scalarOut[x % sampleCount];
+	}
+	std::chrono::duration<double> scalarTime{ std::chrono::steady_clock::now() - startTime };
+	std::cout << "AudioMixer, " << AudioMixer::byteBlocksPerRegister << " samples per register: " << vectorizedTime.count() * 1000000.0 / frameCount
+			  << " us per frame, against " << scalarTime.count() * 1000000.0 / frameCount << " us for the scalar reference (checksum " << checksum << ")." << std::endl;
+
+	std::cout << (didWePass ? "PASS" : "FAIL") << std::endl;
+	return didWePass ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+// GatewayInflateCheck.cpp - Checks GatewayInflater against a zlib-stream deflated the way the gateway does it, and measures its throughput.
+// Oct 18, 2026
+// https://discordcoreapi.com
+
+#include <discordcoreapi/Utilities/GatewayInflater.hpp>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#if defined(DiscordCoreAPI_ZLIB)
+	#include <zlib.h>
+
+namespace {
+
+	constexpr uint64_t payloadCount{ 20000 };
+
+	/// Deflates payloads into one shared context, sync-flushing after each - as the gateway does for a connection.
+	class GatewayDeflater {
+	  public:
+		inline GatewayDeflater() {
+			deflateInit(&stream, Z_DEFAULT_COMPRESSION);
+		}
+
+		inline std::string deflate(const std::string& payload) {
+			std::string outData(deflateBound(&stream, static_cast<uLong>(payload.size())) + 16, '\0');
+			stream.next_in	 = reinterpret_cast<Bytef*>(const_cast<char*>(payload.data()));
+			stream.avail_in	 = static_cast<uInt>(payload.size());
+			stream.next_out	 = reinterpret_cast<Bytef*>(outData.data());
+			stream.avail_out = static_cast<uInt>(outData.size());
+			::deflate(&stream, Z_SYNC_FLUSH);
+			outData.resize(outData.size() - stream.avail_out);
+			return outData;
+		}
+
+		inline ~GatewayDeflater() {
+			deflateEnd(&stream);
+		}
+
+	  protected:
+		z_stream stream{};
+	};
+
+	/// A dispatch-like payload - mostly repetitive, with the odd one large enough to outgrow the inflater's output buffer.
+	std::string makePayload(std::mt19937_64& randomEngine, uint64_t index) {
+		std::string payload{ "{\"t\":\"MESSAGE_CREATE\",\"s\":" + std::to_string(index) + ",\"op\":0,\"d\":{\"content\":\"" };
+		uint64_t length{ index % 500 == 0 ? 200000 : randomEngine() % 2000 };
+		for (uint64_t x = 0; x < length; ++x) {
+			payload.push_back(static_cast<char>('a' + randomEngine() % 16));
+		}
+		payload += "\"}}";
+		return payload;
+	}
+
+}
+
+int32_t main() {
+	bool didWePass{ true };
+	std::mt19937_64 randomEngine{ 1 };
+	std::vector<std::string> payloads{};
+	std::vector<std::string> messages{};
+	{
+		GatewayDeflater deflater{};
+		for (uint64_t x = 0; x < payloadCount; ++x) {
+			payloads.emplace_back(makePayload(randomEngine, x));
+			messages.emplace_back(deflater.deflate(payloads.back()));
+		}
+	}
+
+	DiscordCoreAPI::DiscordCoreInternal::GatewayInflater inflater{};
+	uint64_t inflatedBytes{};
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint64_t x = 0; x < payloadCount; ++x) {
+		std::string_view outData{};
+		// Every third payload arrives split across two messages, as a large one can.
+		if (x % 3 == 0 && messages[x].size() > 8) {
+			uint64_t splitIndex{ messages[x].size() / 2 };
+			if (inflater.inflate(std::string_view{ messages[x] }.substr(0, splitIndex), outData)) {
+				std::cout << "FAIL: Payload " << x << " was reported whole after its first half." << std::endl;
+				didWePass = false;
+			}
+			if (!inflater.inflate(std::string_view{ messages[x] }.substr(splitIndex), outData)) {
+				std::cout << "FAIL: Payload " << x << " was not reported whole after its second half." << std::endl;
+				didWePass = false;
+				continue;
+			}
+		} else if (!inflater.inflate(messages[x], outData)) {
+			std::cout << "FAIL: Payload " << x << " was not reported whole." << std::endl;
+			didWePass = false;
+			continue;
+		}
+		if (outData != payloads[x]) {
+			std::cout << "FAIL: Payload " << x << " inflated to the wrong bytes." << std::endl;
+			didWePass = false;
+		}
+		inflatedBytes += outData.size();
+	}
+	std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - startTime };
+	std::cout << "Inflated " << payloadCount << " payloads, " << inflatedBytes / (1024 * 1024) << " MiB, at " << static_cast<double>(inflatedBytes) / (1024.0 * 1024.0) / elapsed.count()
+			  << " MiB/s." << std::endl;
+
+	// A corrupt payload must throw, and leave the inflater ready for the fresh stream of the connection that replaces it.
+	bool didItThrow{};
+	try {
+		std::string_view outData{};
+		inflater.inflate(std::string_view{ "\xde\xad\xbe\xef\x00\x00\xff\xff", 8 }, outData);
+	} catch (const DiscordCoreAPI::DCAException&) {
+		didItThrow = true;
+	}
+	if (!didItThrow) {
+		std::cout << "FAIL: A corrupt payload did not throw." << std::endl;
+		didWePass = false;
+	}
+	GatewayDeflater deflater{};
+	std::string_view outData{};
+	if (!inflater.inflate(deflater.deflate(payloads[1]), outData) || outData != payloads[1]) {
+		std::cout << "FAIL: The inflater did not recover after a corrupt payload." << std::endl;
+		didWePass = false;
+	}
+
+	std::cout << (didWePass ? "PASS" : "FAIL") << std::endl;
+	return didWePass ? 0 : 1;
+}
+
+#else
+
+int32_t main() {
+	std::cout << "SKIP: The library was built without zlib." << std::endl;
+	return 0;
+}
+
+#endif
@@ -0,0 +1,85 @@
+// ObjectCacheEviction.cpp - Checks ObjectCache's entry limit, time-to-live reclamation and copying lookups.
+// Oct 18, 2026
+// https://discordcoreapi.com
+
+#include <discordcoreapi/Index.hpp>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+	using RoleCache = DiscordCoreAPI::ObjectCache<DiscordCoreAPI::RoleCacheData>;
+
+	bool didWePass{ true };
+
+	void check(bool condition, const std::string& message) {
+		if (!condition) {
+			std::cout << "FAIL: " << message << std::endl;
+			didWePass = false;
+		}
+	}
+
+	DiscordCoreAPI::RoleCacheData makeRole(uint64_t id) {
+		DiscordCoreAPI::RoleCacheData role{};
+		role.id	   = id;
+		role.color = id;
+		return role;
+	}
+
+	/// A capped cache holds no more than its per-shard share of the limit, rounded up, in any shard.
+	void checkMaxEntries() {
+		constexpr uint64_t maxEntries{ 1024 };
+		RoleCache cache{};
+		cache.setLimits({ .maxEntries = maxEntries });
+		for (uint64_t x = 1; x <= maxEntries * 8; ++x) {
+			cache.emplace(makeRole(x));
+		}
+		auto stats = cache.getStats();
+		check(cache.size() <= maxEntries + RoleCache::shardCount, "The capped cache holds " + std::to_string(cache.size()) + " objects.");
+		check(stats.evictions >= maxEntries * 7 - RoleCache::shardCount, "The capped cache evicted only " + std::to_string(stats.evictions) + " objects.");
+	}
+
+	/// With only a time-to-live set, nothing fills the cache up to force a sweep - the inserts themselves have to reclaim what has expired.
+	void checkTimeToLive() {
+		constexpr uint64_t objectCount{ 4096 };
+		RoleCache cache{};
+		cache.setLimits({ .ttlInSeconds = 1 });
+		for (uint64_t x = 1; x <= objectCount; ++x) {
+			cache.emplace(makeRole(x));
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 2100 });
+		check(!cache.contains(DiscordCoreAPI::Snowflake{ 1 }), "An expired object was still served.");
+		for (uint64_t x = objectCount + 1; x <= objectCount * 2; ++x) {
+			cache.emplace(makeRole(x));
+		}
+		auto stats = cache.getStats();
+		check(stats.expirations >= objectCount / 2, "Only " + std::to_string(stats.expirations) + " of " + std::to_string(objectCount) + " expired objects were reclaimed.");
+		check(cache.size() <= objectCount + objectCount / 2, "The time-limited cache still holds " + std::to_string(cache.size()) + " objects.");
+	}
+
+	/// at() hands out a copy, and throws rather than inserting for a missing key.
+	void checkAt() {
+		RoleCache cache{};
+		cache.emplace(makeRole(1));
+		DiscordCoreAPI::RoleCacheData role{ cache.at(DiscordCoreAPI::Snowflake{ 1 }) };
+		check(role.color == 1, "at() read back the wrong object.");
+		role.color = 2;
+		check(cache.at(DiscordCoreAPI::Snowflake{ 1 }).color == 1, "Writing to the copy from at() changed the cache.");
+		bool didItThrow{};
+		try {
+			cache.at(DiscordCoreAPI::Snowflake{ 2 });
+		} catch (const DiscordCoreAPI::DCAException&) {
+			didItThrow = true;
+		}
+		check(didItThrow && cache.size() == 1, "at() did not throw for a missing key, or inserted it.");
+	}
+
+}
+
+int32_t main() {
+	checkMaxEntries();
+	checkTimeToLive();
+	checkAt();
+	std::cout << (didWePass ? "PASS" : "FAIL") << std::endl;
+	return didWePass ? 0 : 1;
+}
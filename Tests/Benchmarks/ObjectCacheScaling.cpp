@@ -0,0 +1,83 @@
+// ObjectCacheScaling.cpp - Measures how ObjectCache's read-mostly throughput scales with the number of threads, and checks what it reads back.
+// Oct 18, 2026
+// https://discordcoreapi.com
+
+#include <discordcoreapi/Index.hpp>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+	constexpr uint64_t objectCount{ 100000 };
+	constexpr uint64_t operationsPerThread{ 1000000 };
+	constexpr uint64_t writesPerHundred{ 10 };
+
+	DiscordCoreAPI::RoleCacheData makeRole(uint64_t id) {
+		DiscordCoreAPI::RoleCacheData role{};
+		role.id	   = id;
+		role.color = id;
+		return role;
+	}
+
+	/// Runs a mix of visits and re-inserts across the cache from threadCount threads, returning the operations per second.
+	double runMix(DiscordCoreAPI::ObjectCache<DiscordCoreAPI::RoleCacheData>& cache, uint64_t threadCount, std::atomic_uint64_t& mismatches) {
+		std::vector<std::thread> threads{};
+		auto startTime = std::chrono::steady_clock::now();
+		for (uint64_t x = 0; x < threadCount; ++x) {
+			threads.emplace_back([&, x] {
+				std::mt19937_64 randomEngine{ x + 1 };
+				for (uint64_t y = 0; y < operationsPerThread; ++y) {
+					uint64_t id{ randomEngine() % objectCount + 1 };
+					if (randomEngine() % 100 < writesPerHundred) {
+						cache.emplace(makeRole(id));
+					} else if (!cache.visit(DiscordCoreAPI::Snowflake{ id }, [&](const DiscordCoreAPI::RoleCacheData& role) {
+								   if (role.color != id) {
+									   mismatches.fetch_add(1, std::memory_order_relaxed);
+								   }
+							   })) {
+						mismatches.fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+			});
+		}
+		for (auto& value: threads) {
+			value.join();
+		}
+		std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - startTime };
+		return static_cast<double>(threadCount * operationsPerThread) / elapsed.count();
+	}
+
+}
+
+int32_t main() {
+	DiscordCoreAPI::ObjectCache<DiscordCoreAPI::RoleCacheData> cache{};
+	std::vector<DiscordCoreAPI::RoleCacheData> roles{};
+	for (uint64_t x = 1; x <= objectCount; ++x) {
+		roles.emplace_back(makeRole(x));
+	}
+	cache.insertRange(roles.begin(), roles.end());
+
+	std::atomic_uint64_t mismatches{};
+	uint64_t maxThreadCount{ std::max<uint64_t>(std::thread::hardware_concurrency(), 1) };
+	double singleThreadRate{};
+	std::cout << "ObjectCache, " << DiscordCoreAPI::ObjectCache<DiscordCoreAPI::RoleCacheData>::shardCount << " shards, " << writesPerHundred << "% writes:" << std::endl;
+	for (uint64_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2) {
+		double rate{ runMix(cache, threadCount, mismatches) };
+		if (threadCount == 1) {
+			singleThreadRate = rate;
+		}
+		std::cout << "  " << threadCount << " threads: " << rate / 1000000.0 << " Mops/s (" << rate / singleThreadRate << "x)" << std::endl;
+	}
+
+	bool didWePass{ mismatches.load() == 0 && cache.size() == objectCount };
+	if (mismatches.load() != 0) {
+		std::cout << "FAIL: " << mismatches.load() << " visits missed or read back the wrong object." << std::endl;
+	}
+	if (cache.size() != objectCount) {
+		std::cout << "FAIL: The cache holds " << cache.size() << " objects rather than " << objectCount << "." << std::endl;
+	}
+	std::cout << (didWePass ? "PASS" : "FAIL") << std::endl;
+	return didWePass ? 0 : 1;
+}
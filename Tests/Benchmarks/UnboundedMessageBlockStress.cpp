@@ -0,0 +1,146 @@
+// UnboundedMessageBlockStress.cpp - N-producer/M-consumer stress test for UnboundedMessageBlock.
+// Oct 18, 2026
+// https://discordcoreapi.com
+
+#include <discordcoreapi/Utilities/UnboundedMessageBlock.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace {
+
+	constexpr uint64_t producerCount{ 4 };
+	constexpr uint64_t consumerCount{ 4 };
+	constexpr uint64_t valuesPerProducer{ 1000000 };
+	constexpr uint64_t maxQueuedValues{ 4096 };
+	constexpr int64_t maxRetiredSegments{ 2048 };
+
+	/// Exposes the size of a segment, so that the allocation hooks below can tell the queue's segments apart from everything else.
+	class StressBlock : public DiscordCoreAPI::UnboundedMessageBlock<uint64_t> {
+	  public:
+		static constexpr uint64_t segmentSize{ sizeof(Segment) };
+		static constexpr uint64_t slotCount{ Segment::slotCount };
+	};
+
+	std::atomic_int64_t liveSegments{};
+	std::atomic_int64_t peakLiveSegments{};
+
+	void trackAllocation(std::size_t size, int64_t delta) {
+		if (size == StressBlock::segmentSize) {
+			int64_t live{ liveSegments.fetch_add(delta, std::memory_order_relaxed) + delta };
+			int64_t peak{ peakLiveSegments.load(std::memory_order_relaxed) };
+			while (live > peak && !peakLiveSegments.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+			}
+		}
+	}
+
+	inline uint64_t makeValue(uint64_t producer, uint64_t sequence) {
+		return (producer << 32) | sequence;
+	}
+
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+	void* newPtr{ std::aligned_alloc(static_cast<std::size_t>(alignment), (size + static_cast<std::size_t>(alignment) - 1) & ~(static_cast<std::size_t>(alignment) - 1)) };
+	if (!newPtr) {
+		throw std::bad_alloc{};
+	}
+	trackAllocation(size, 1);
+	return newPtr;
+}
+
+void operator delete(void* ptr, std::size_t size, std::align_val_t) noexcept {
+	trackAllocation(size, -1);
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+	std::free(ptr);
+}
+
+int32_t main() {
+	std::vector<std::atomic_uint8_t> seen(producerCount * valuesPerProducer);
+	std::atomic_uint64_t receivedCount{};
+	std::atomic_uint64_t orderErrors{};
+	std::atomic_uint64_t duplicates{};
+	std::atomic_bool areWeDone{};
+	{
+		StressBlock block{};
+		std::vector<std::thread> threads{};
+		for (uint64_t x = 0; x < producerCount; ++x) {
+			threads.emplace_back([&, x] {
+				for (uint64_t y = 0; y < valuesPerProducer; ++y) {
+					while (block.size() >= maxQueuedValues) {
+						std::this_thread::yield();
+					}
+					block.send(makeValue(x, y));
+				}
+			});
+		}
+		for (uint64_t x = 0; x < consumerCount; ++x) {
+			threads.emplace_back([&] {
+				// Every consumer must see each producer's values in the order they were sent.
+				std::vector<int64_t> lastSequences(producerCount, -1);
+				uint64_t value{};
+				while (true) {
+					if (!block.tryReceive(value)) {
+						if (areWeDone.load(std::memory_order_acquire) && !block.tryReceive(value)) {
+							break;
+						} else if (!areWeDone.load(std::memory_order_acquire)) {
+							std::this_thread::yield();
+							continue;
+						}
+					}
+					uint64_t producer{ value >> 32 };
+					int64_t sequence{ static_cast<int64_t>(value & 0xffffffff) };
+					if (sequence <= lastSequences[producer]) {
+						orderErrors.fetch_add(1, std::memory_order_relaxed);
+					}
+					lastSequences[producer] = sequence;
+					if (seen[producer * valuesPerProducer + static_cast<uint64_t>(sequence)].exchange(1, std::memory_order_relaxed)) {
+						duplicates.fetch_add(1, std::memory_order_relaxed);
+					}
+					receivedCount.fetch_add(1, std::memory_order_relaxed);
+				}
+			});
+		}
+		for (uint64_t x = 0; x < producerCount; ++x) {
+			threads[x].join();
+		}
+		areWeDone.store(true, std::memory_order_release);
+		for (uint64_t x = producerCount; x < threads.size(); ++x) {
+			threads[x].join();
+		}
+	}
+
+	// The queue holds at most maxQueuedValues values (plus one per producer that raced past the check). The slack on top of that covers the segments
+	// retired while a preempted thread holds back the epoch - which does not grow with the length of the run, whereas a reclamation that is starved
+	// leaves every retired segment alive until the queue goes idle.
+	int64_t maxLiveSegments{ static_cast<int64_t>((maxQueuedValues + producerCount) / StressBlock::slotCount) + maxRetiredSegments };
+	bool didWePass{ true };
+	if (receivedCount.load() != producerCount * valuesPerProducer) {
+		std::cout << "FAIL: Received " << receivedCount.load() << " of " << producerCount * valuesPerProducer << " values." << std::endl;
+		didWePass = false;
+	}
+	if (duplicates.load() != 0) {
+		std::cout << "FAIL: Received " << duplicates.load() << " values more than once." << std::endl;
+		didWePass = false;
+	}
+	if (orderErrors.load() != 0) {
+		std::cout << "FAIL: Received " << orderErrors.load() << " values out of their producer's order." << std::endl;
+		didWePass = false;
+	}
+	if (peakLiveSegments.load() > maxLiveSegments) {
+		std::cout << "FAIL: " << peakLiveSegments.load() << " segments were alive at once, against a bound of " << maxLiveSegments << "." << std::endl;
+		didWePass = false;
+	}
+	if (liveSegments.load() != 0) {
+		std::cout << "FAIL: " << liveSegments.load() << " segments were never freed." << std::endl;
+		didWePass = false;
+	}
+	std::cout << (didWePass ? "PASS" : "FAIL") << ": " << producerCount << " producers, " << consumerCount << " consumers, peak of " << peakLiveSegments.load()
+			  << " live segments." << std::endl;
+	return didWePass ? 0 : 1;
+}